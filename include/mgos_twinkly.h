@@ -27,7 +27,9 @@ extern "C" {
 #define MGOS_TWINKLY_EV_BASE   MGOS_EVENT_BASE('T', 'W', 'K')
 #define MGOS_EVENT_GRP_TWINKLY MGOS_TWINKLY_EV_BASE
 
-#define MGOS_TWINKLY_HTTP_TIMEOUT_S 10.0
+#define MGOS_TWINKLY_HTTP_TIMEOUT_S     10.0
+#define MGOS_TWINKLY_HTTP_KEEPALIVE_S   30.0 // idle keep-alive connection lifetime
+#define MGOS_TWINKLY_HTTP_POOL_IDLE_MAX 4    // idle keep-alive connections limit
 
 #define MGOS_TWINKLY_ERROR_OK       0
 #define MGOS_TWINKLY_ERROR_EXISTS   1
@@ -35,6 +37,7 @@ extern "C" {
 #define MGOS_TWINKLY_ERROR_MEM      3
 #define MGOS_TWINKLY_ERROR_RESPONSE 4
 #define MGOS_TWINKLY_ERROR_JSTORE   5
+#define MGOS_TWINKLY_ERROR_UNBOUND  6 // device record lost its address, waiting for re-resolution
 
 enum mgos_twinkly_event {
     MGOS_TWINKLY_EV_INITIALIZED = MGOS_TWINKLY_EV_BASE,
@@ -81,22 +84,291 @@ struct async_ctx {
     void* arg;
     struct http_message* hm;
     struct mg_str auth_token;
+    double auth_expires; // auth_token expiration, mg_time() based
     struct mg_str ip;
 };
 
 // Iterate through device s list
 bool mgos_twinkly_iterate(mgos_twinkly_iterate_cb_t cb);
-// Number of devices in store
+// Number of devices in store, O(1), no flash access
 int mgos_twinkly_count();
 // Turn on / off
 bool mgos_twinkly_set_mode(int idx, bool mode);
 // Set brightness
 bool mgos_twinkly_set_brightness(int idx, int value);
-// Get product info by given product code
-bool mgos_twinkly_get_product(char* code, struct mgos_twinkly_product** product);
+// Cached state, timestamps are mg_time() of the last update, 0 - not known yet
+struct mgos_twinkly_state {
+    bool online;
+    int mode;       // 0 - off, 1 - on
+    int brightness; // 0-100 %
+    double online_ts;
+    double mode_ts;
+    double brightness_ts;
+};
+
+// From RAM, no network traffic
+bool mgos_twinkly_get_state(int idx, struct mgos_twinkly_state* state);
+// Request mode and brightness, the cache is updated with replies
+bool mgos_twinkly_state_refresh(int idx);
+// Get product info by given product code into caller storage, strings point to the constant catalog
+bool mgos_twinkly_get_product(const char* code, struct mgos_twinkly_product* product);
 // Clear all devices
 void mgos_twinkly_reset(void);
 
+// Pixel format conversion from canonical RGB (3 bytes per LED) to led_profile wire format:
+// RGB - R G B, RGBW - W R G B, AWW - A WW CW, RBW - R B W
+typedef void (*mgos_twinkly_pixel_fn_t)(const uint8_t* src, uint8_t* dst, size_t leds);
+
+// Get conversion kernel and bytes per LED for led_profile, NULL if not supported
+mgos_twinkly_pixel_fn_t mgos_twinkly_pixel_get_fn(const char* led_profile, int* bpl);
+// Canonical float RGB (0.0 - 1.0) to canonical RGB
+void mgos_twinkly_pixel_from_float(const float* src, uint8_t* dst, size_t leds);
+
+// Color correction lookup tables: gamma, brightness and white point, one lookup per channel
+struct mgos_twinkly_lut {
+    uint8_t r[256];
+    uint8_t g[256];
+    uint8_t b[256];
+    float gamma;
+    int brightness; // 0 - 100 %
+    int kelvin;     // white point, 0 - not corrected
+};
+
+// Precompute tables, call on parameters change only
+void mgos_twinkly_lut_build(struct mgos_twinkly_lut* lut, float gamma, int brightness, int kelvin);
+// Apply to canonical RGB frame, src and dst may be the same buffer
+void mgos_twinkly_lut_apply(const struct mgos_twinkly_lut* lut, const uint8_t* src, uint8_t* dst, size_t leds);
+
+// Realtime output (led/rt/frame over UDP)
+#define MGOS_TWINKLY_RT_PORT        7777
+#define MGOS_TWINKLY_RT_KEEPALIVE_S 2.0 // unchanged frame resend interval, keeps device in rt mode
+
+// Switch device to rt mode and open UDP stream, cb gets (void*) MGOS_TWINKLY_ERROR_x
+bool mgos_twinkly_rt_start(int idx, tw_cb_t cb, void* arg);
+// Close UDP stream, device returns to previous mode on rt timeout
+void mgos_twinkly_rt_stop(int idx);
+// Stream is ready for frames
+bool mgos_twinkly_rt_active(int idx);
+// Frame size in bytes: number_of_led * bytes_per_led
+int mgos_twinkly_rt_frame_size(int idx);
+// Send frame in device wire format right away, bypassing pacing
+bool mgos_twinkly_rt_send(int idx, const uint8_t* frame, size_t len);
+
+// Paced output: stream ticks at device measured_frame_rate (frame_rate as fallback) and sends the latest frame.
+// Frame source, called on every tick to render into the frame buffer, returns false if frame is not changed
+typedef bool (*mgos_twinkly_rt_source_t)(uint8_t* frame, size_t len, void* arg);
+
+struct mgos_twinkly_rt_stats {
+    uint32_t frames_sent;      // including keepalives
+    uint32_t frames_skipped;   // unchanged frames not sent
+    uint32_t frames_keepalive; // unchanged frames resent to hold rt mode
+    uint32_t frames_dropped;   // submitted frames overwritten before the tick
+    uint32_t ticks_late;       // ticks fired later than half period
+    uint32_t ticks_skipped;    // deadlines missed entirely
+    uint32_t jitter_avg_us;    // tick deadline jitter, moving average
+    uint32_t jitter_max_us;
+    uint32_t skew_us;          // send offset from the first group member, last tick
+    float fps;                 // target frame rate
+};
+
+// Queue frame for the next tick, unsent previous frame is dropped
+bool mgos_twinkly_rt_submit(int idx, const uint8_t* frame, size_t len);
+// Same, for canonical RGB frame (3 bytes per LED), color corrected and converted to the device led_profile
+bool mgos_twinkly_rt_submit_rgb(int idx, const uint8_t* rgb, size_t leds);
+// Set color correction for submitted RGB frames, tables are rebuilt only if parameters changed
+bool mgos_twinkly_rt_set_correction(int idx, float gamma, int brightness, int kelvin);
+// Set frame source, NULL to use submitted frames only
+bool mgos_twinkly_rt_set_source(int idx, mgos_twinkly_rt_source_t source, void* arg);
+// Set canonical RGB frame source (3 bytes per LED), color corrected and converted on every changed frame
+bool mgos_twinkly_rt_set_source_rgb(int idx, mgos_twinkly_rt_source_t source, void* arg);
+bool mgos_twinkly_rt_get_stats(int idx, struct mgos_twinkly_rt_stats* stats);
+
+// Frame store: triple buffered canonical RGB frames with lock-free handoff, so a renderer
+// on the second core or a worker thread never blocks the networking loop.
+// The stream takes the latest published frame on every tick, older ones are dropped.
+struct mgos_twinkly_rt_store;
+
+// Main loop only. Store takes precedence over the frame source while attached.
+// The store belongs to the caller: it outlives the stream (frames are just not sent then)
+// and is freed only by mgos_twinkly_rt_store_detach()
+struct mgos_twinkly_rt_store* mgos_twinkly_rt_store_attach(int idx);
+// Main loop only, producer must be stopped first
+void mgos_twinkly_rt_store_detach(struct mgos_twinkly_rt_store* s);
+// Producer side, single producer: render into the back buffer, then publish it
+uint8_t* mgos_twinkly_rt_store_back(struct mgos_twinkly_rt_store* s, size_t* leds);
+void mgos_twinkly_rt_store_publish(struct mgos_twinkly_rt_store* s);
+
+// Group output: one tick renders a shared canonical RGB canvas, cuts it into member frames
+// in the order of adding and sends them back-to-back
+struct mgos_twinkly_rt_group;
+
+struct mgos_twinkly_rt_group_stats {
+    uint32_t ticks;
+    uint32_t ticks_late;
+    uint32_t ticks_skipped;
+    uint32_t jitter_avg_us;
+    uint32_t jitter_max_us;
+    uint32_t skew_avg_us; // first to last member send within a tick, moving average
+    uint32_t skew_max_us;
+    float fps;
+};
+
+// fps <= 0 - pace of the slowest member
+struct mgos_twinkly_rt_group* mgos_twinkly_rt_group_new(float fps);
+// Add device with started rt stream, canvas grows by its number of LEDs
+bool mgos_twinkly_rt_group_add(struct mgos_twinkly_rt_group* g, int idx);
+uint8_t* mgos_twinkly_rt_group_canvas(struct mgos_twinkly_rt_group* g, size_t* leds);
+// Canvas source, called on every group tick with the whole canvas
+bool mgos_twinkly_rt_group_set_source(struct mgos_twinkly_rt_group* g, mgos_twinkly_rt_source_t source, void* arg);
+bool mgos_twinkly_rt_group_start(struct mgos_twinkly_rt_group* g);
+// Members return to their own pacing
+void mgos_twinkly_rt_group_free(struct mgos_twinkly_rt_group* g);
+bool mgos_twinkly_rt_group_get_stats(struct mgos_twinkly_rt_group* g, struct mgos_twinkly_rt_group_stats* stats);
+
+// LED layout (led/layout/full), coordinates in Q14 fixed point: x -1..1, y 0..1 (bottom to top), z -1..1
+#define MGOS_TWINKLY_LAYOUT_ONE (1 << 14)
+
+// Field callback, renders canonical RGB for all LEDs from their coordinates in one pass
+typedef void (*mgos_twinkly_field_fn_t)(
+        const int16_t* x, const int16_t* y, const int16_t* z, int leds, uint8_t* rgb, void* arg);
+
+// Fetch and cache device layout, once per device, cb gets (void*) MGOS_TWINKLY_ERROR_x
+bool mgos_twinkly_layout_fetch(int idx, tw_cb_t cb, void* arg);
+// Cached coordinates, false if not fetched yet
+bool mgos_twinkly_layout_get(int idx, const int16_t** x, const int16_t** y, const int16_t** z, int* leds);
+// Nearest pixel of RGB image (w x h, rows top to bottom) for every LED, pixel map is cached per image size
+bool mgos_twinkly_layout_sample_image(int idx, const uint8_t* image, int w, int h, uint8_t* rgb);
+bool mgos_twinkly_layout_sample_field(int idx, mgos_twinkly_field_fn_t fn, void* arg, uint8_t* rgb);
+
+// Effect engine: integer only procedural effects rendering canonical RGB,
+// mgos_twinkly_effect_render() is a frame source for mgos_twinkly_rt_set_source_rgb() and group canvas
+enum mgos_twinkly_effect_type {
+    MGOS_TWINKLY_EFFECT_RAINBOW = 0,
+    MGOS_TWINKLY_EFFECT_FIRE,
+    MGOS_TWINKLY_EFFECT_TWINKLE,
+    MGOS_TWINKLY_EFFECT_CHASE,
+    MGOS_TWINKLY_EFFECT_GRADIENT, // sweep between hue and hue2
+};
+
+struct mgos_twinkly_effect_params {
+    uint8_t speed;   // step per frame in 1/16: hue units, chase - LEDs
+    uint8_t hue;     // 0 - 255 color wheel
+    uint8_t hue2;    // gradient end
+    uint8_t density; // rainbow and gradient: cycles over the strip; twinkle: spawn chance; fire: sparking; chase: gap
+    uint8_t size;    // chase segment length; fire: cooling
+};
+
+struct mgos_twinkly_effect_stats {
+    uint32_t frames;
+    uint32_t cost_avg_us; // render time per 1000 LEDs, moving average
+    uint32_t cost_max_us;
+    uint32_t budget_us;   // per 1000 LEDs
+    uint32_t over_budget; // frames over budget
+};
+
+struct mgos_twinkly_effect;
+
+struct mgos_twinkly_effect* mgos_twinkly_effect_new(
+        enum mgos_twinkly_effect_type type, const struct mgos_twinkly_effect_params* params);
+void mgos_twinkly_effect_set_params(struct mgos_twinkly_effect* e, const struct mgos_twinkly_effect_params* params);
+// mgos_twinkly_rt_source_t, arg is the effect, len is 3 bytes per LED
+bool mgos_twinkly_effect_render(uint8_t* rgb, size_t len, void* arg);
+bool mgos_twinkly_effect_get_stats(struct mgos_twinkly_effect* e, struct mgos_twinkly_effect_stats* stats);
+void mgos_twinkly_effect_free(struct mgos_twinkly_effect* e);
+
+// Movie upload (gen1 families): frames are streamed into led/movie/full one by one as the socket drains,
+// then led/movie/config is applied and the device is switched to movie mode
+#define MGOS_TWINKLY_MOVIE_FRAME_DELAY_MS 40
+
+// Movie generator, renders canonical RGB frame (3 bytes per LED), false to abort the upload
+typedef bool (*mgos_twinkly_movie_frame_fn_t)(int frame, uint8_t* rgb, size_t len, void* arg);
+
+struct mgos_twinkly_movie {
+    int frames;
+    int frame_delay_ms;                // 0 - MGOS_TWINKLY_MOVIE_FRAME_DELAY_MS
+    const char* path;                  // file with frames in the device wire format, or
+    mgos_twinkly_movie_frame_fn_t gen; // generator, has to be deterministic, frames are hashed before upload
+    void* gen_arg;
+    uint64_t hash; // content hash, 0 - computed from the frames
+};
+
+struct mgos_twinkly_movie_progress {
+    size_t bytes_sent;
+    size_t bytes_total;
+    int frames;
+    double started; // mg_time() based
+    double elapsed_s;
+    uint32_t bytes_per_s;
+    bool done;
+    bool skipped; // device already has the movie, only mode was set
+};
+
+typedef void (*mgos_twinkly_movie_progress_cb_t)(
+        const struct mg_str* ip, const struct mgos_twinkly_movie_progress* progress, void* arg);
+
+// Progress is reported every 0.5 s and on finish, cb gets (void*) MGOS_TWINKLY_ERROR_x.
+// Upload is skipped if the device record content hash and led/movie/config match the movie
+bool mgos_twinkly_movie_upload(
+        int idx,
+        const struct mgos_twinkly_movie* movie,
+        mgos_twinkly_movie_progress_cb_t progress_cb,
+        tw_cb_t cb,
+        void* arg);
+
+// Same movie to many devices with equal frame geometry: encoded once into a shared file and streamed
+// to not more than concurrency devices at a time. Progress is per device, cb gets the result below
+#define MGOS_TWINKLY_MOVIE_CONCURRENCY 2
+
+struct mgos_twinkly_movie_fanout_result {
+    int targets;
+    int succeeded;
+    int failed;
+    int skipped;      // succeeded without transfer
+    double elapsed_s; // wall-clock time for all devices
+};
+
+bool mgos_twinkly_movie_upload_many(
+        const int* idx,
+        int count,
+        const struct mgos_twinkly_movie* movie,
+        int concurrency,
+        mgos_twinkly_movie_progress_cb_t progress_cb,
+        tw_cb_t cb,
+        void* arg);
+
+// Discovery (UDP broadcast)
+#define MGOS_TWINKLY_DISCOVER_PORT      5555
+#define MGOS_TWINKLY_DISCOVER_TIMEOUT_S 3.0
+
+struct mgos_twinkly_discovered {
+    struct mg_str ip;
+    struct mg_str name;
+    bool known;     // already in the device list
+    int add_result; // MGOS_TWINKLY_ERROR_x, -1 if not added
+};
+
+// Devices are valid during the call only
+typedef void (*mgos_twinkly_discover_cb_t)(const struct mgos_twinkly_discovered* devices, int count, void* arg);
+
+// Collect replies within timeout_s (0 - default), new devices are added with mgos_twinkly_add() if add is set
+bool mgos_twinkly_discover(double timeout_s, bool add, mgos_twinkly_discover_cb_t cb, void* arg);
+
+// Bulk add: gestalt probes run concurrently, not more than limit (0 - default) at a time,
+// accepted devices are stored with a single store write and config save
+#define MGOS_TWINKLY_ADD_LIMIT    4
+#define MGOS_TWINKLY_ADD_MANY_MAX 256
+
+struct mgos_twinkly_add_result {
+    struct mg_str ip;
+    int res; // MGOS_TWINKLY_ERROR_x
+};
+
+// Results are in request order, valid during the call only
+typedef void (*mgos_twinkly_add_many_cb_t)(const struct mgos_twinkly_add_result* results, int count, void* arg);
+
+// Addresses are copied, false if nothing was started
+bool mgos_twinkly_add_many(const struct mg_str* ips, int count, int limit, mgos_twinkly_add_many_cb_t cb, void* arg);
+
 // library
 bool mgos_twinkly_init(void);
 void mgos_twinkly_deinit(void);
@@ -14,43 +14,40 @@
  * limitations under the License.
  */
 
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
 #include "mgos.h"
+#include "common/queue.h"
 #include "mgos_rpc.h"
 #include "mgos_jstore.h"
 #include "mgos_mqtt.h"
 #include "mgos_twinkly.h"
+#include "twinkly_internal.h"
 #include "twinkly_products.h"
 
-#define JSON_PATH                 "twinkly.json"
-#define METHOD_GESTALT            "gestalt"
-#define METHOD_LOGIN              "login"
-#define METHOD_LOGOUT             "logout"
-#define METHOD_VERIFY             "verify"
-#define METHOD_STATUS             "status"
-#define METHOD_SUMMARY            "summary"
-#define METHOD_DEVICE_NAME        "device_name"
-#define METHOD_LED_MODE           "led/mode"
-#define METHOD_LED_CONFIG         "led/config"
-#define METHOD_LED_DRIVER_PARAMS  "led/driver_params"
-#define METHOD_LED_RESET          "led/reset"
-#define METHOD_LED_OUT_BRIGHTNESS "led/out/brightness"
-#define METHOD_LED_MODE_CONFIG    "led/movie/config"
-#define METHOD_FW_VERSION         "fw/version"
-#define METHOD_TIMER              "timer"
-#define METHOD_NETWORK_SCAN       "network/scan"
-#define METHOD_NETWORK_STATUS     "network/status"
-#define METHOD_MQTT_CONFIG        "mqtt/config"
-
-static int s_devices_number = 0;
+#define JSON_PATH      "twinkly.json"
+#define DEVICE_IP_PATH "._ip" // records are keyed by MAC, address is an attribute
+
+#define RESOLVE_TIMEOUTS   3    // consecutive timeouts before re-resolving addresses
+#define RESOLVE_INTERVAL_S 60.0 // re-resolving not more often than this
+
+#define AUTH_TOKEN_EXPIRES_IN_S    14400 // used when login response has no expiration
+#define AUTH_TOKEN_EXPIRY_MARGIN_S 60    // re-login a bit earlier than device drops the token
+
+#define STATE_POLL_TICK_MIN_MS    1000 // large lists are polled slower than the interval
+#define STATE_POLL_OFFLINE_ROUNDS 4    // offline devices are probed every Nth round only
+
+#define MQTT_TOPIC "xled/#"
+
 static bool s_cloud_connected = false;
+static mgos_timer_id s_poll_timer = MGOS_INVALID_TIMER_ID;
+static int s_poll_next = 0;  // round robin cursor
+static int s_poll_round = 0; // cursor wraps
 
-static void
-        twinkly_device_request(struct async_ctx* device, char* method, const char* post_data, tw_cb_t cb, void* arg);
 static void twinkly_login_request(struct async_ctx* device);
 static void twinkly_verify_request(struct async_ctx* device, char* data);
 
@@ -60,57 +57,421 @@ struct cb_ctx {
     void* userdata;
 };
 
-static struct async_ctx* twinkly_device_new(struct mg_str ip) {
+// Verified auth token, kept between device requests
+struct twinkly_session {
+    struct mg_str ip;
+    struct mg_str auth_token;
+    double expires; // mg_time() based
+    SLIST_ENTRY(twinkly_session) next;
+};
+
+static SLIST_HEAD(s_sessions, twinkly_session) s_sessions = SLIST_HEAD_INITIALIZER(s_sessions);
+
+static struct twinkly_session* twinkly_session_find(struct mg_str ip) {
+    struct twinkly_session* s;
+    SLIST_FOREACH(s, &s_sessions, next) {
+        if (mg_strcmp(s->ip, ip) == 0)
+            return s;
+    }
+    return NULL;
+}
+
+static void twinkly_session_drop(struct mg_str ip) {
+    struct twinkly_session* s = twinkly_session_find(ip);
+    if (!s)
+        return;
+    LOG(LL_DEBUG, ("%s %.*s", __func__, ip.len, ip.p));
+    SLIST_REMOVE(&s_sessions, s, twinkly_session, next);
+    mg_strfree(&s->ip);
+    mg_strfree(&s->auth_token);
+    free(s);
+}
+
+static void twinkly_session_save(struct async_ctx* device) {
+    if (!device->auth_token.p)
+        return;
+    struct twinkly_session* s = twinkly_session_find(device->ip);
+    if (!s) {
+        s = calloc(1, sizeof(struct twinkly_session));
+        if (!s)
+            return;
+        s->ip = mg_strdup(device->ip);
+        SLIST_INSERT_HEAD(&s_sessions, s, next);
+    }
+    mg_strfree(&s->auth_token);
+    s->auth_token = mg_strdup(device->auth_token);
+    s->expires = device->auth_expires;
+    // Login invalidates previous token, realtime stream has to follow
+    struct twinkly_device* dev = twinkly_registry_get(twinkly_registry_find(device->ip));
+    if (dev && dev->rt)
+        twinkly_rt_token_update(dev, s->auth_token);
+    LOG(LL_DEBUG, ("%s %.*s expires in %ld s", __func__, device->ip.len, device->ip.p, (long) (s->expires - mg_time())));
+}
+
+static void twinkly_sessions_free(void) {
+    while (!SLIST_EMPTY(&s_sessions))
+        twinkly_session_drop(SLIST_FIRST(&s_sessions)->ip);
+}
+
+struct async_ctx* twinkly_device_new(struct mg_str ip) {
     struct async_ctx* device = calloc(1, sizeof(struct async_ctx));
     if (!device)
         return NULL;
     memset(device, 0, sizeof(struct async_ctx));
     device->ip = mg_strdup(ip);
+    // Reusing verified token, login is skipped then
+    struct twinkly_session* s = twinkly_session_find(ip);
+    if (s) {
+        if (mg_time() < s->expires) {
+            device->auth_token = mg_strdup(s->auth_token);
+            device->auth_expires = s->expires;
+        } else {
+            twinkly_session_drop(ip);
+        }
+    }
     return device;
 }
 
-static void twinkly_device_free(struct async_ctx* device) {
+void twinkly_device_free(struct async_ctx* device) {
     LOG(LL_DEBUG, ("%s %.*s", __func__, device->ip.len, device->ip.p));
     mg_strfree(&device->ip);
     mg_strfree(&device->auth_token);
     free(device);
 }
 
-static int jstore_add_device(struct mg_str* ip, struct mg_str json, int* index) {
-    LOG(LL_DEBUG, ("%s %.*s %.*s", __func__, ip->len, ip->p, json.len, json.p));
-    char* mac = NULL;
-    if (json_scanf(json.p, json.len, "{mac: %Q}", &mac) == 0) {
-        LOG(LL_ERROR, ("Invalid response"));
-        return MGOS_TWINKLY_ERROR_RESPONSE;
+#define FAMILY_UNKNOWN 0
+#define FAMILY_DEFAULT 1 // gestalt without fw_family
+
+const struct twinkly_family twinkly_families[] = {
+    { "", 0, "{\"mode\":\"effect\"}", false, 1, 3 },
+    // Gen1: A B C D E H J K
+    { "A", 1, "{\"mode\":\"movie\"}", true, 1, 3 },
+    { "B", 1, "{\"mode\":\"movie\"}", true, 1, 3 },
+    { "C", 1, "{\"mode\":\"movie\"}", true, 1, 3 },
+    { "D", 1, "{\"mode\":\"movie\"}", true, 1, 3 },
+    { "E", 1, "{\"mode\":\"movie\"}", true, 1, 3 },
+    { "H", 1, "{\"mode\":\"movie\"}", true, 2, 3 },
+    { "J", 1, "{\"mode\":\"movie\"}", true, 2, 3 },
+    { "K", 1, "{\"mode\":\"movie\"}", true, 2, 3 },
+    // Gen2: F G L M N P, SSL only MQTT (current gen2 fw = 2.5.6)
+    { "F", 2, "{\"mode\":\"playlist\"}", false, 3, 4 },
+    { "G", 2, "{\"mode\":\"playlist\"}", false, 3, 4 },
+    { "L", 2, "{\"mode\":\"playlist\"}", false, 3, 4 },
+    { "M", 2, "{\"mode\":\"playlist\"}", false, 3, 4 },
+    { "N", 2, "{\"mode\":\"playlist\"}", false, 3, 4 },
+    { "P", 2, "{\"mode\":\"playlist\"}", false, 3, 4 },
+};
+
+static uint8_t twinkly_family_find(struct mg_str json) {
+    char* f = NULL;
+    if (json_scanf(json.p, json.len, "{fw_family: %Q}", &f) != 1)
+        return FAMILY_DEFAULT;
+    uint8_t res = FAMILY_UNKNOWN;
+    for (int i = 1; i < sizeof(twinkly_families) / sizeof(twinkly_families[0]); i++)
+        if (strcmp(f, twinkly_families[i].name) == 0) {
+            res = i;
+            break;
+        }
+    free(f);
+    return res;
+}
+
+// Stored devices, loaded from JSON_PATH once and kept in the same order as jstore items
+static struct twinkly_device* s_devices = NULL;
+static int s_devices_cnt = 0; // kept current on load, add, remove and reset
+
+struct twinkly_device* twinkly_registry_get(int idx) {
+    if (idx < 0 || idx >= s_devices_cnt)
+        return NULL;
+    return &s_devices[idx];
+}
+
+int twinkly_registry_find(struct mg_str ip) {
+    // Unbound records have no address to match
+    if (!ip.len)
+        return -1;
+    for (int i = 0; i < s_devices_cnt; i++)
+        if (mg_strcmp(s_devices[i].ip, ip) == 0)
+            return i;
+    return -1;
+}
+
+// MAC hash index, open addressing with linear probing. Registry indexes shift on remove,
+// the index is rebuilt then, lookups never see a stale index.
+struct mac_slot {
+    uint64_t key; // 48-bit MAC
+    int idx;      // registry index, -1 - empty slot
+};
+
+static struct mac_slot* s_mac_index = NULL;
+static int s_mac_index_size = 0; // power of two, at least twice the device count
+
+// 12 hex digits, colons are skipped, case insensitive
+static bool mac_key(struct mg_str mac, uint64_t* key) {
+    uint64_t k = 0;
+    int digits = 0;
+    for (size_t i = 0; i < mac.len; i++) {
+        int c = tolower((unsigned char) mac.p[i]);
+        if (c == ':')
+            continue;
+        if (!isxdigit(c) || ++digits > 12)
+            return false;
+        k = (k << 4) | (uint64_t)(c <= '9' ? c - '0' : c - 'a' + 10);
+    }
+    *key = k;
+    return digits == 12;
+}
+
+static uint32_t mac_hash(uint64_t key) {
+    return (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+static void mac_index_insert(uint64_t key, int idx) {
+    uint32_t mask = (uint32_t) s_mac_index_size - 1;
+    uint32_t i = mac_hash(key) & mask;
+    while (s_mac_index[i].idx >= 0)
+        i = (i + 1) & mask;
+    s_mac_index[i].key = key;
+    s_mac_index[i].idx = idx;
+}
+
+static void mac_index_rebuild(void) {
+    int size = 8;
+    while (size < 2 * s_devices_cnt)
+        size <<= 1;
+    if (size != s_mac_index_size) {
+        struct mac_slot* slots = realloc(s_mac_index, size * sizeof(struct mac_slot));
+        if (!slots) {
+            LOG(LL_ERROR, ("Failed to allocate MAC index"));
+            free(s_mac_index);
+            s_mac_index = NULL;
+            s_mac_index_size = 0;
+            return;
+        }
+        s_mac_index = slots;
+        s_mac_index_size = size;
+    }
+    for (int i = 0; i < size; i++)
+        s_mac_index[i].idx = -1;
+    uint64_t key;
+    for (int i = 0; i < s_devices_cnt; i++)
+        if (mac_key(s_devices[i].mac, &key))
+            mac_index_insert(key, i);
+}
+
+static int mac_index_find(uint64_t key) {
+    if (!s_mac_index)
+        return -1;
+    uint32_t mask = (uint32_t) s_mac_index_size - 1;
+    for (uint32_t i = mac_hash(key) & mask; s_mac_index[i].idx >= 0; i = (i + 1) & mask)
+        if (s_mac_index[i].key == key)
+            return s_mac_index[i].idx;
+    return -1;
+}
+
+int twinkly_registry_find_mac(struct mg_str mac) {
+    uint64_t key;
+    return mac_key(mac, &key) ? mac_index_find(key) : -1;
+}
+
+// Gestalt MAC in lower case, NULL if missing or invalid
+static char* twinkly_json_mac(struct mg_str json) {
+    char* str = NULL;
+    if (json_scanf(json.p, json.len, "{mac: %Q}", &str) != 1)
+        return NULL;
+    unsigned char a[6];
+    int last = -1;
+    int rc = sscanf(str, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx%n", a + 0, a + 1, a + 2, a + 3, a + 4, a + 5, &last);
+    if (rc != 6 || 17 != last) {
+        LOG(LL_ERROR, ("Invalid mac address: %s", str));
+        free(str);
+        return NULL;
     }
+    snprintf(str, 18, "%02x:%02x:%02x:%02x:%02x:%02x", a[0], a[1], a[2], a[3], a[4], a[5]);
+    return str;
+}
+
+// Gestalt with the address attribute set, mb is initialized here
+static struct mg_str twinkly_json_set_ip(struct mbuf* mb, struct mg_str json, struct mg_str ip) {
+    mbuf_init(mb, json.len + ip.len + 16);
+    struct json_out out = JSON_OUT_MBUF(mb);
+    json_setf(json.p, json.len, &out, DEVICE_IP_PATH, "%.*Q", ip.len, ip.p);
+    return mg_mk_str_n(mb->buf, mb->len);
+}
 
+static int registry_add(struct mg_str mac, struct mg_str ip, struct mg_str json) {
+    struct twinkly_device* devices = realloc(s_devices, (s_devices_cnt + 1) * sizeof(struct twinkly_device));
+    if (!devices)
+        return -1;
+    s_devices = devices;
+    struct twinkly_device* dev = &s_devices[s_devices_cnt];
+    memset(dev, 0, sizeof(struct twinkly_device));
+    dev->mac = mg_strdup(mac);
+    dev->ip = mg_strdup(ip);
+    dev->json = mg_strdup(json);
+    dev->family = twinkly_family_find(json);
+    int idx = s_devices_cnt++;
+    uint64_t key;
+    if (2 * s_devices_cnt > s_mac_index_size)
+        mac_index_rebuild();
+    else if (mac_key(mac, &key))
+        mac_index_insert(key, idx);
+    return idx;
+}
+
+static void registry_remove(int idx) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev)
+        return;
+    twinkly_rt_free(dev->rt);
+    twinkly_layout_free(dev->layout);
+    mg_strfree(&dev->mac);
+    mg_strfree(&dev->ip);
+    mg_strfree(&dev->json);
+    memmove(dev, dev + 1, (s_devices_cnt - idx - 1) * sizeof(struct twinkly_device));
+    s_devices_cnt--;
+    mac_index_rebuild();
+}
+
+static void registry_clear(void) {
+    while (s_devices_cnt)
+        registry_remove(s_devices_cnt - 1);
+    free(s_devices);
+    s_devices = NULL;
+    free(s_mac_index);
+    s_mac_index = NULL;
+    s_mac_index_size = 0;
+}
+
+static bool registry_load_cb(
+        struct mgos_jstore* store,
+        int idx,
+        mgos_jstore_item_hnd_t hnd,
+        const struct mg_str* id,
+        const struct mg_str* data,
+        void* userdata) {
+    bool res = true;
+    char* ip = NULL;
+    if (json_scanf(data->p, data->len, "{_ip: %Q}", &ip) == 1) {
+        res = registry_add(*id, mg_mk_str(ip), *data) >= 0;
+    } else {
+        // Legacy record keyed by address, re-keyed by registry_load()
+        char* mac = twinkly_json_mac(*data);
+        if (mac) {
+            struct mbuf mb;
+            struct mg_str json = twinkly_json_set_ip(&mb, *data, *id);
+            res = registry_add(mg_mk_str(mac), *id, json) >= 0;
+            mbuf_free(&mb);
+            free(mac);
+        } else {
+            LOG(LL_ERROR, ("%.*s - record without mac, skipped", id->len, id->p));
+        }
+    }
+    free(ip);
+    return res;
+    (void) store;
+    (void) idx;
+    (void) hnd;
+    (void) userdata;
+}
+
+static bool registry_load(void) {
+    registry_clear();
     struct mgos_jstore* store = mgos_jstore_create(JSON_PATH, NULL);
     if (!store) {
         LOG(LL_ERROR, ("Failed to open jstore %s", JSON_PATH));
-        return MGOS_TWINKLY_ERROR_JSTORE;
+        return false;
+    }
+    bool res = mgos_jstore_iterate(store, registry_load_cb, NULL);
+    if (!res)
+        LOG(LL_ERROR, ("Failed to load data from jstore"));
+    // Migrating address keyed records, saved once
+    int migrated = 0;
+    for (int i = 0; res && i < s_devices_cnt; i++) {
+        struct twinkly_device* dev = &s_devices[i];
+        if (mgos_jstore_item_get(store, MGOS_JSTORE_REF_BY_ID(dev->mac), NULL, NULL, NULL, NULL, NULL))
+            continue;
+        mgos_jstore_item_remove(store, MGOS_JSTORE_REF_BY_ID(dev->ip), NULL);
+        char* err = NULL;
+        mgos_jstore_item_add(
+                store, dev->mac, dev->json, MGOS_JSTORE_OWN_FOREIGN, MGOS_JSTORE_OWN_FOREIGN, NULL, NULL, &err);
+        if (err) {
+            LOG(LL_ERROR, ("%.*s - migration failed: %s", dev->ip.len, dev->ip.p, err));
+            free(err);
+            continue;
+        }
+        migrated++;
+    }
+    if (migrated) {
+        LOG(LL_INFO, ("%ld records migrated to mac keys", (long) migrated));
+        if (!mgos_jstore_save(store, JSON_PATH, NULL))
+            LOG(LL_ERROR, ("Failed to save jstore %s", JSON_PATH));
+    }
+    mgos_jstore_free(store);
+    LOG(LL_INFO, ("%ld devices loaded", (long) s_devices_cnt));
+    return res;
+}
+
+// Flash is only touched here, on device add / remove / edit
+// Store item and registry entry for a gestalt, the store is saved by the caller
+static int jstore_add_item(struct mgos_jstore* store, struct mg_str* ip, struct mg_str json, int* index) {
+    LOG(LL_DEBUG, ("%s %.*s %.*s", __func__, ip->len, ip->p, json.len, json.p));
+    char* mac = twinkly_json_mac(json);
+    if (!mac) {
+        LOG(LL_ERROR, ("Invalid response"));
+        return MGOS_TWINKLY_ERROR_RESPONSE;
+    }
+    // Same device could be found by discovery under another address
+    if (twinkly_registry_find(*ip) >= 0 || twinkly_registry_find_mac(mg_mk_str(mac)) >= 0) {
+        free(mac);
+        return MGOS_TWINKLY_ERROR_EXISTS;
     }
+    struct mbuf mb;
+    struct mg_str data = twinkly_json_set_ip(&mb, json, *ip);
+    char* err = NULL;
     int res = MGOS_TWINKLY_ERROR_OK;
     mgos_jstore_item_hnd_t hnd;
-    if (mgos_jstore_item_get(store, MGOS_JSTORE_REF_BY_ID(*ip), NULL, NULL, &hnd, NULL, NULL)) {
+    if (mgos_jstore_item_get(store, MGOS_JSTORE_REF_BY_ID(mg_mk_str(mac)), NULL, NULL, &hnd, NULL, NULL)) {
         res = MGOS_TWINKLY_ERROR_EXISTS;
         goto clean;
     }
-    char* err;
-    mgos_jstore_item_add(store, *ip, json, MGOS_JSTORE_OWN_FOREIGN, MGOS_JSTORE_OWN_FOREIGN, NULL, index, &err);
+    mgos_jstore_item_add(store, mg_mk_str(mac), data, MGOS_JSTORE_OWN_COPY, MGOS_JSTORE_OWN_COPY, NULL, NULL, &err);
     if (err) {
         res = MGOS_TWINKLY_ERROR_JSTORE;
         goto clean;
     }
-    if (!mgos_jstore_save(store, JSON_PATH, NULL))
-        res = MGOS_TWINKLY_ERROR_JSTORE;
+    // Registry index, store order changes on migration
+    *index = registry_add(mg_mk_str(mac), *ip, data);
+    if (*index < 0) {
+        mgos_jstore_item_remove(store, MGOS_JSTORE_REF_BY_ID(mg_mk_str(mac)), NULL);
+        res = MGOS_TWINKLY_ERROR_MEM;
+    }
 clean:
-    mgos_jstore_free(store);
+    mbuf_free(&mb);
+    free(mac);
     free(err);
     return res;
 }
 
-static int jstore_remove_device(struct mg_str* ip) {
-    LOG(LL_DEBUG, ("%s %.*s", __func__, ip->len, ip->p));
+static int jstore_add_device(struct mg_str* ip, struct mg_str json, int* index) {
+    struct mgos_jstore* store = mgos_jstore_create(JSON_PATH, NULL);
+    if (!store) {
+        LOG(LL_ERROR, ("Failed to open jstore %s", JSON_PATH));
+        return MGOS_TWINKLY_ERROR_JSTORE;
+    }
+    int res = jstore_add_item(store, ip, json, index);
+    if (res == MGOS_TWINKLY_ERROR_OK && !mgos_jstore_save(store, JSON_PATH, NULL)) {
+        registry_remove(*index);
+        res = MGOS_TWINKLY_ERROR_JSTORE;
+    }
+    mgos_jstore_free(store);
+    return res;
+}
+
+static int jstore_remove_device(int idx) {
+    LOG(LL_DEBUG, ("%s %d", __func__, idx));
+    if (!twinkly_registry_get(idx))
+        return MGOS_TWINKLY_ERROR_EXISTS;
 
     struct mgos_jstore* store = mgos_jstore_create(JSON_PATH, NULL);
     if (!store) {
@@ -118,87 +479,380 @@ static int jstore_remove_device(struct mg_str* ip) {
         return MGOS_TWINKLY_ERROR_JSTORE;
     }
     int res = MGOS_TWINKLY_ERROR_OK;
+    struct mg_str mac = twinkly_registry_get(idx)->mac;
     mgos_jstore_item_hnd_t hnd;
-    if (!mgos_jstore_item_get(store, MGOS_JSTORE_REF_BY_ID(*ip), NULL, NULL, &hnd, NULL, NULL)) {
+    if (!mgos_jstore_item_get(store, MGOS_JSTORE_REF_BY_ID(mac), NULL, NULL, &hnd, NULL, NULL)) {
         res = MGOS_TWINKLY_ERROR_EXISTS;
         goto clean;
     }
-    if (!mgos_jstore_item_remove(store, MGOS_JSTORE_REF_BY_ID(*ip), NULL)) {
+    if (!mgos_jstore_item_remove(store, MGOS_JSTORE_REF_BY_ID(mac), NULL)) {
         res = MGOS_TWINKLY_ERROR_JSTORE;
         goto clean;
     }
-    if (!mgos_jstore_save(store, JSON_PATH, NULL))
+    if (!mgos_jstore_save(store, JSON_PATH, NULL)) {
         res = MGOS_TWINKLY_ERROR_JSTORE;
+        goto clean;
+    }
+    registry_remove(idx);
 clean:
     mgos_jstore_free(store);
     return res;
 }
 
+int twinkly_device_edit(int idx, const char* json_path, const char* value) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev)
+        return MGOS_TWINKLY_ERROR_EXISTS;
+    LOG(LL_DEBUG, ("%s %.*s %s %s", __func__, dev->ip.len, dev->ip.p, json_path, value));
+    struct mbuf mb;
+    mbuf_init(&mb, dev->json.len + strlen(value) + 16);
+    struct json_out out = JSON_OUT_MBUF(&mb);
+    json_setf(dev->json.p, dev->json.len, &out, json_path, "%s", value);
+    struct mg_str json = mg_mk_str_n(mb.buf, mb.len);
+    struct mgos_jstore* store = mgos_jstore_create(JSON_PATH, NULL);
+    if (!store) {
+        LOG(LL_ERROR, ("Failed to open jstore %s", JSON_PATH));
+        mbuf_free(&mb);
+        return MGOS_TWINKLY_ERROR_JSTORE;
+    }
+    int res = MGOS_TWINKLY_ERROR_OK;
+    if (!mgos_jstore_item_edit(store, MGOS_JSTORE_REF_BY_ID(dev->mac), json, MGOS_JSTORE_OWN_COPY, NULL)) {
+        res = MGOS_TWINKLY_ERROR_JSTORE;
+        goto clean;
+    }
+    if (!mgos_jstore_save(store, JSON_PATH, NULL)) {
+        res = MGOS_TWINKLY_ERROR_JSTORE;
+        goto clean;
+    }
+    mg_strfree(&dev->json);
+    dev->json = mg_strdup(json);
+clean:
+    mgos_jstore_free(store);
+    mbuf_free(&mb);
+    return res;
+}
+
 // HTTP
+// Persistent (keep-alive) connection to the device
+struct twinkly_conn {
+    struct mg_str ip;
+    struct mg_connection* c;
+    struct cb_ctx* cc; // request in progress, NULL when idle
+    char* request;     // request in progress, kept to be replayed on reconnect
+    int served;        // replies received over this connection
+    bool received;     // reply bytes of the request in progress arrived
+    bool closing;      // closed locally, requests in progress are not replayed
+    double last_used;
+    SLIST_ENTRY(twinkly_conn) next;
+};
+
+static SLIST_HEAD(s_conns, twinkly_conn) s_conns = SLIST_HEAD_INITIALIZER(s_conns);
+
+static void ev_handler(struct mg_connection* c, int ev, void* p, void* user_data);
+static void twinkly_device_reachable(struct mg_str ip, bool ok);
+
+static bool twinkly_conn_is_idle(struct twinkly_conn* conn) {
+    return conn->c && !conn->cc && !(conn->c->flags & (MG_F_CLOSE_IMMEDIATELY | MG_F_SEND_AND_CLOSE));
+}
+
+static struct twinkly_conn* twinkly_conn_open(struct mg_str* ip) {
+    struct twinkly_conn* conn = calloc(1, sizeof(struct twinkly_conn));
+    if (!conn)
+        return NULL;
+    char* addr = NULL;
+    mg_asprintf(&addr, 0, "tcp://%.*s:80", ip->len, ip->p);
+    conn->c = mg_connect(mgos_get_mgr(), addr, ev_handler, conn);
+    free(addr);
+    if (!conn->c) {
+        free(conn);
+        return NULL;
+    }
+    mg_set_protocol_http_websocket(conn->c);
+    conn->ip = mg_strdup(*ip);
+    conn->last_used = mg_time();
+    SLIST_INSERT_HEAD(&s_conns, conn, next);
+    return conn;
+}
+
+// Keeping not more than MGOS_TWINKLY_HTTP_POOL_IDLE_MAX idle sockets, oldest go first
+static void twinkly_conn_trim(void) {
+    for (;;) {
+        int idle = 0;
+        struct twinkly_conn *conn, *oldest = NULL;
+        SLIST_FOREACH(conn, &s_conns, next) {
+            if (!twinkly_conn_is_idle(conn))
+                continue;
+            idle++;
+            if (!oldest || conn->last_used < oldest->last_used)
+                oldest = conn;
+        }
+        if (idle <= MGOS_TWINKLY_HTTP_POOL_IDLE_MAX)
+            break;
+        LOG(LL_DEBUG, ("%s %.*s - evicting idle connection", __func__, oldest->ip.len, oldest->ip.p));
+        oldest->c->flags |= MG_F_CLOSE_IMMEDIATELY;
+    }
+}
+
+static void twinkly_conn_send(struct mg_str* ip, struct cb_ctx* cc, char* request, bool reuse) {
+    struct twinkly_conn* conn = NULL;
+    if (reuse) {
+        SLIST_FOREACH(conn, &s_conns, next) {
+            if (twinkly_conn_is_idle(conn) && mg_strcmp(conn->ip, *ip) == 0)
+                break;
+        }
+    }
+    if (!conn)
+        conn = twinkly_conn_open(ip);
+    if (!conn) {
+        LOG(LL_ERROR, ("%.*s - failed to connect", ip->len, ip->p));
+        if (cc && cc->cb)
+            cc->cb(NULL, cc->arg);
+        free(cc);
+        free(request);
+        return;
+    }
+    conn->cc = cc;
+    conn->request = request;
+    conn->received = false;
+    mg_send(conn->c, request, strlen(request));
+    mg_set_timer(conn->c, mg_time() + MGOS_TWINKLY_HTTP_TIMEOUT_S);
+}
+
+// Request is done (reply, error or timeout), connection is idle from now
+static struct cb_ctx* twinkly_conn_release(struct twinkly_conn* conn) {
+    struct cb_ctx* cc = conn->cc;
+    conn->cc = NULL;
+    free(conn->request);
+    conn->request = NULL;
+    conn->last_used = mg_time();
+    return cc;
+}
+
+static void twinkly_conn_fail(struct twinkly_conn* conn) {
+    struct cb_ctx* cc = twinkly_conn_release(conn);
+    twinkly_device_reachable(conn->ip, false);
+    // Calling user callback now
+    if (cc && cc->cb)
+        cc->cb(NULL, cc->arg); // twinkly_add_cb(hm, cb_ctx)
+    free(cc);
+}
+
 static void ev_handler(struct mg_connection* c, int ev, void* p, void* user_data) {
-    struct cb_ctx* cc = user_data;
+    struct twinkly_conn* conn = user_data;
+    if (!conn)
+        return;
     switch (ev) {
         case MG_EV_CONNECT: {
             int err = *(int*) p;
             if (err) {
-                // Calling user callback now
-                if (cc && cc->cb)
-                    cc->cb(NULL, cc->arg); // twinkly_add_cb(hm, cb_ctx)
-                free(cc);
-                c->user_data = NULL;
-            } else {
-                mg_set_timer(c, mg_time() + MGOS_TWINKLY_HTTP_TIMEOUT_S);
+                LOG(LL_ERROR, ("%.*s - connect error %d", conn->ip.len, conn->ip.p, err));
+                twinkly_conn_fail(conn);
+                c->flags |= MG_F_CLOSE_IMMEDIATELY;
             }
             break;
         };
         case MG_EV_HTTP_REPLY: {
             struct http_message* hm = (struct http_message*) p;
-            c->flags |= MG_F_CLOSE_IMMEDIATELY;
             LOG(LL_DEBUG, ("%.*s", hm->body.len, hm->body.p));
-            // Calling user callback now
+            struct cb_ctx* cc = twinkly_conn_release(conn);
+            conn->served++;
+            twinkly_device_reachable(conn->ip, true);
+            struct mg_str* hdr = mg_get_http_header(hm, "Connection");
+            if (hdr && mg_vcasecmp(hdr, "close") == 0)
+                c->flags |= MG_F_CLOSE_IMMEDIATELY;
+            else
+                mg_set_timer(c, mg_time() + MGOS_TWINKLY_HTTP_KEEPALIVE_S);
+            twinkly_conn_trim();
+            // Calling user callback now, it may reuse this connection
             if (cc && cc->cb)
                 cc->cb(hm, cc->arg); // twinkly_add_cb(hm, cb_ctx)
             free(cc);
-            c->user_data = NULL;
+            break;
+        };
+        case MG_EV_RECV: {
+            if (conn->cc)
+                conn->received = true;
             break;
         };
         case MG_EV_TIMER: {
             c->flags |= MG_F_CLOSE_IMMEDIATELY;
-            char addr[32];
-            mg_sock_addr_to_str(&c->sa, (char*) addr, sizeof(addr), MG_SOCK_STRINGIFY_IP | MG_SOCK_STRINGIFY_PORT);
-            LOG(LL_INFO, ("%s - timed out, closing", addr));
-            // Calling user callback now
-            if (cc && cc->cb)
-                cc->cb(NULL, cc->arg); // twinkly_add_cb(hm, cb_ctx)
-            free(cc);
-            c->user_data = NULL;
+            if (conn->cc) {
+                char addr[32];
+                mg_sock_addr_to_str(&c->sa, (char*) addr, sizeof(addr), MG_SOCK_STRINGIFY_IP | MG_SOCK_STRINGIFY_PORT);
+                LOG(LL_INFO, ("%s - timed out, closing", addr));
+                twinkly_conn_fail(conn);
+            }
             break;
         };
         case MG_EV_CLOSE: {
             char addr[32];
             mg_sock_addr_to_str(&c->sa, (char*) addr, sizeof(addr), MG_SOCK_STRINGIFY_IP | MG_SOCK_STRINGIFY_PORT);
             LOG(LL_INFO, ("%s - closing connection, flags %02X", addr, (int) c->flags));
+            SLIST_REMOVE(&s_conns, conn, twinkly_conn, next);
+            c->user_data = NULL;
+            if (conn->cc) {
+                // Device dropped the kept-alive socket: a GET is safe to replay, other methods only
+                // if the device did not start replying
+                bool get = strncmp(conn->request, "GET ", 4) == 0;
+                if (conn->served && !conn->closing && (get || !conn->received)) {
+                    LOG(LL_DEBUG, ("%s - reconnecting", addr));
+                    twinkly_conn_send(&conn->ip, conn->cc, conn->request, false);
+                    conn->cc = NULL;
+                    conn->request = NULL;
+                } else {
+                    twinkly_conn_fail(conn);
+                }
+            }
+            mg_strfree(&conn->ip);
+            free(conn);
+            break;
         };
     }
 }
 
+static void twinkly_conns_close(void) {
+    struct twinkly_conn* conn;
+    SLIST_FOREACH(conn, &s_conns, next) {
+        conn->closing = true;
+        conn->c->flags |= MG_F_CLOSE_IMMEDIATELY;
+    }
+}
+
 static void http_request(
         struct mg_str* ip,
         char* method,
         void* user_data,
         const char* extra_headers,
         const char* post_data) {
-    char* url = NULL;
-    mg_asprintf(&url, 0, "http://%.*s/xled/v1/%s", ip->len, ip->p, method);
     LOG(LL_DEBUG,
-        ("%s %s\r\n%s\r\n%s",
+        ("%s http://%.*s/xled/v1/%s\r\n%s\r\n%s",
          __func__,
-         url,
+         ip->len,
+         ip->p,
+         method,
          extra_headers ? extra_headers : "[no extra headers]",
          post_data ? post_data : "[no data]"));
-    struct mg_connection* c = mg_connect_http(mgos_get_mgr(), ev_handler, user_data, url, extra_headers, post_data);
-    free(url);
-    (void) c;
+    if (!ip->len) {
+        // Unbound device record, nothing to connect to
+        struct cb_ctx* cc = user_data;
+        if (cc && cc->cb)
+            cc->cb(NULL, cc->arg);
+        free(cc);
+        return;
+    }
+    char* request = NULL;
+    mg_asprintf(
+            &request,
+            0,
+            "%s /xled/v1/%s HTTP/1.1\r\nHost: %.*s\r\nConnection: keep-alive\r\nContent-Length: %lu\r\n%s\r\n%s",
+            post_data ? "POST" : "GET",
+            method,
+            ip->len,
+            ip->p,
+            (unsigned long) (post_data ? strlen(post_data) : 0),
+            extra_headers ? extra_headers : "",
+            post_data ? post_data : "");
+    if (!request) {
+        struct cb_ctx* cc = user_data;
+        if (cc && cc->cb)
+            cc->cb(NULL, cc->arg);
+        free(cc);
+        return;
+    }
+    twinkly_conn_send(ip, user_data, request, true);
+}
+
+// Address re-resolution: after repeated timeouts the addresses found by discovery are probed
+// with gestalt and a known MAC behind a new address moves the device there
+static bool s_resolving = false;
+static double s_resolved_at = 0;
+
+// Empty ip unbinds the record, it stays unresolved until discovery finds its MAC again
+static int twinkly_device_move(int idx, struct mg_str ip) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    LOG(LL_INFO, ("%.*s - device %.*s moved to %.*s", dev->ip.len, dev->ip.p, dev->mac.len, dev->mac.p, ip.len, ip.p));
+    // Address swap, the stale holder of the new address must not get this device's traffic
+    int holder = ip.len ? twinkly_registry_find(ip) : -1;
+    if (holder >= 0 && holder != idx) {
+        int res = twinkly_device_move(holder, mg_mk_str(""));
+        if (res != MGOS_TWINKLY_ERROR_OK)
+            return res;
+        s_devices[holder].timeouts = RESOLVE_TIMEOUTS;
+        twinkly_state_set(holder, MGOS_TWINKLY_EV_STATUS, 0);
+    }
+    char* value = NULL;
+    mg_asprintf(&value, 0, "\"%.*s\"", ip.len, ip.p);
+    int res = value ? twinkly_device_edit(idx, DEVICE_IP_PATH, value) : MGOS_TWINKLY_ERROR_MEM;
+    free(value);
+    if (res != MGOS_TWINKLY_ERROR_OK)
+        return res;
+    // Session and stream are bound to the old address
+    twinkly_session_drop(dev->ip);
+    twinkly_rt_free(dev->rt);
+    dev->rt = NULL;
+    mg_strfree(&dev->ip);
+    dev->ip = mg_strdup(ip);
+    dev->timeouts = 0;
+    return res;
+}
+
+static void resolve_gestalt_cb(void* data, void* arg) {
+    struct http_message* hm = data;
+    struct mg_str* ip = arg;
+    char* mac = (hm && hm->resp_code == 200) ? twinkly_json_mac(hm->body) : NULL;
+    int idx = mac ? twinkly_registry_find_mac(mg_mk_str(mac)) : -1;
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (dev && mg_strcmp(dev->ip, *ip) != 0)
+        twinkly_device_move(idx, *ip);
+    free(mac);
+    mg_strfree(ip);
+    free(ip);
+}
+
+static void resolve_discover_cb(const struct mgos_twinkly_discovered* devices, int count, void* arg) {
+    s_resolving = false;
+    for (int i = 0; i < count; i++) {
+        // Healthy devices keep their addresses
+        struct twinkly_device* dev = twinkly_registry_get(twinkly_registry_find(devices[i].ip));
+        if (dev && !dev->timeouts)
+            continue;
+        struct mg_str* ip = calloc(1, sizeof(struct mg_str));
+        struct cb_ctx* cadd = calloc(1, sizeof(struct cb_ctx));
+        if (!ip || !cadd) {
+            free(ip);
+            free(cadd);
+            break;
+        }
+        *ip = mg_strdup(devices[i].ip);
+        cadd->cb = resolve_gestalt_cb;
+        cadd->arg = ip;
+        http_request(ip, METHOD_GESTALT, cadd, NULL, NULL);
+    }
+    (void) arg;
+}
+
+static void twinkly_device_reachable(struct mg_str ip, bool ok) {
+    int idx = twinkly_registry_find(ip);
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev)
+        return;
+    if (ok) {
+        dev->timeouts = 0;
+        twinkly_state_set(idx, MGOS_TWINKLY_EV_STATUS, 1);
+        return;
+    }
+    if (dev->timeouts < UINT8_MAX)
+        dev->timeouts++;
+    if (dev->timeouts >= RESOLVE_TIMEOUTS)
+        twinkly_resolve();
+}
+
+void twinkly_resolve(void) {
+    if (s_resolving || (s_resolved_at && mg_time() - s_resolved_at < RESOLVE_INTERVAL_S))
+        return;
+    LOG(LL_INFO, ("Re-resolving addresses"));
+    s_resolved_at = mg_time();
+    s_resolving = mgos_twinkly_discover(0, false, resolve_discover_cb, NULL);
 }
 
 static int status_to_int(char* status) {
@@ -215,6 +869,62 @@ static int mode_to_int(char* mode) {
         return 1;
 }
 
+// Cached state update, the event is raised when the value changes or becomes known
+bool twinkly_state_set(int idx, int ev, int value) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev)
+        return false;
+    struct mgos_twinkly_state* s = &dev->state;
+    double now = mg_time();
+    bool changed;
+    switch (ev) {
+        case MGOS_TWINKLY_EV_STATUS: {
+            changed = !s->online_ts || s->online != (value != 0);
+            s->online = value != 0;
+            s->online_ts = now;
+            break;
+        }
+        case MGOS_TWINKLY_EV_MODE: {
+            changed = !s->mode_ts || s->mode != value;
+            s->mode = value;
+            s->mode_ts = now;
+            break;
+        }
+        case MGOS_TWINKLY_EV_BRIGHTNESS: {
+            changed = !s->brightness_ts || s->brightness != value;
+            s->brightness = value;
+            s->brightness_ts = now;
+            break;
+        }
+        default:
+            return false;
+    }
+    if (changed) {
+        mgos_twinkly_ev_data_t data = { .index = idx, .value = value };
+        mgos_event_trigger(ev, &data);
+    }
+    return changed;
+}
+
+// Mode and brightness replies go to the state cache, set requests carry the value in the request only
+static void twinkly_state_reply(struct async_ctx* device, struct http_message* hm) {
+    int idx = twinkly_registry_find(device->ip);
+    int code = 0;
+    if (idx < 0 || !device->method || json_scanf(hm->body.p, hm->body.len, "{code: %d}", &code) != 1 || code != 1000)
+        return;
+    struct mg_str json = device->post_data ? mg_mk_str(device->post_data) : hm->body;
+    if (strcmp(device->method, METHOD_LED_MODE) == 0) {
+        char* mode = NULL;
+        if (json_scanf(json.p, json.len, "{mode: %Q}", &mode) == 1)
+            twinkly_state_set(idx, MGOS_TWINKLY_EV_MODE, mode_to_int(mode));
+        free(mode);
+    } else if (strcmp(device->method, METHOD_LED_OUT_BRIGHTNESS) == 0) {
+        int value = 0;
+        if (json_scanf(json.p, json.len, "{value: %d}", &value) == 1)
+            twinkly_state_set(idx, MGOS_TWINKLY_EV_BRIGHTNESS, value);
+    }
+}
+
 static void twinkly_verify_cb(void* data, void* arg) {
     LOG(LL_DEBUG, ("%s %p %p", __func__, data, arg));
     if (!arg) {
@@ -240,6 +950,9 @@ static void twinkly_verify_cb(void* data, void* arg) {
             LOG(LL_ERROR, ("verify error, code %ld", (long) code));
             // verify error, killing auth_token to re-login and retry
             mg_strfree(&device->auth_token);
+            twinkly_session_drop(device->ip);
+        } else {
+            twinkly_session_save(device);
         }
         twinkly_device_request(device, device->method, device->post_data, device->cb, device->arg);
     }
@@ -324,7 +1037,13 @@ static void twinkly_login_cb(void* data, void* arg) {
     if (json_scanf(json.p, json.len, "{authentication_token: %Q}", &at) == 1) {
         mg_strfree(&device->auth_token);
         device->auth_token = mg_strdup(mg_mk_str(at));
+        free(at);
     }
+    int expires_in = AUTH_TOKEN_EXPIRES_IN_S;
+    json_scanf(json.p, json.len, "{authentication_token_expires_in: %d}", &expires_in);
+    if (expires_in > 2 * AUTH_TOKEN_EXPIRY_MARGIN_S)
+        expires_in -= AUTH_TOKEN_EXPIRY_MARGIN_S;
+    device->auth_expires = mg_time() + expires_in;
     char* cr = NULL;
     if (json_scanf(json.p, json.len, "{challenge-response: %Q}", &cr) == 1) {
         char* data = NULL;
@@ -349,10 +1068,13 @@ static void twinkly_device_cb(void* data, void* arg) {
         goto exit;
     LOG(LL_DEBUG, ("resp %ld: %.*s", (long) hm->resp_code, hm->body.len, hm->body.p));
     if (hm->resp_code == 401) {
+        // Token expired or device rebooted
+        mg_strfree(&device->auth_token);
+        twinkly_session_drop(device->ip);
         twinkly_login_request(device);
         return;
     } else if (hm->resp_code == 200) {
-        // ALL OK
+        twinkly_state_reply(device, hm);
     } else {
         // not expect json answer here
     }
@@ -364,8 +1086,7 @@ exit:
         twinkly_device_free(device);
 }
 
-static void
-        twinkly_device_request(struct async_ctx* device, char* method, const char* post_data, tw_cb_t cb, void* arg) {
+void twinkly_device_request(struct async_ctx* device, char* method, const char* post_data, tw_cb_t cb, void* arg) {
     LOG(LL_DEBUG, ("%s %s", __func__, method));
     // async context fill
     device->method = method;
@@ -464,111 +1185,33 @@ static void mqtt_handler(
         const char* msg,
         int msg_len,
         void* userdata) {
-    mgos_twinkly_ev_data_t data;
-    data.index = (int) userdata;
-    LOG(LL_DEBUG, ("%ld %.*s: %.*s", (long) userdata, topic_len, topic, msg_len, msg));
+    // xled/<kind>/<MAC>, MAC is 12 hex digits
+    const char* mac = topic + topic_len;
+    while (mac > topic && mac[-1] != '/')
+        mac--;
+    uint64_t key;
+    int idx = mac_key(mg_mk_str_n(mac, topic + topic_len - mac), &key) ? mac_index_find(key) : -1;
+    LOG(LL_DEBUG, ("%ld %.*s: %.*s", (long) idx, topic_len, topic, msg_len, msg));
+    if (idx < 0)
+        return;
     char* str;
     str = NULL;
-    if (json_scanf(msg, msg_len, "{appstatus: %Q}", &str) == 1) {
-        data.value = mode_to_int(str);
-        mgos_event_trigger(MGOS_TWINKLY_EV_MODE, &data);
-    }
+    if (json_scanf(msg, msg_len, "{appstatus: %Q}", &str) == 1)
+        twinkly_state_set(idx, MGOS_TWINKLY_EV_MODE, mode_to_int(str));
+    free(str);
     str = NULL;
-    if (json_scanf(msg, msg_len, "{status: %Q}", &str) == 1) {
-        data.value = status_to_int(str);
-        mgos_event_trigger(MGOS_TWINKLY_EV_STATUS, &data);
-    }
+    if (json_scanf(msg, msg_len, "{status: %Q}", &str) == 1)
+        twinkly_state_set(idx, MGOS_TWINKLY_EV_STATUS, status_to_int(str));
+    free(str);
     int brightness = 0;
-    if (json_scanf(msg, msg_len, "{brightness: %d}", &brightness) == 1) {
-        data.value = brightness;
-        mgos_event_trigger(MGOS_TWINKLY_EV_BRIGHTNESS, &data);
-    }
+    if (json_scanf(msg, msg_len, "{brightness: %d}", &brightness) == 1)
+        twinkly_state_set(idx, MGOS_TWINKLY_EV_BRIGHTNESS, brightness);
     // if (strstr(topic, "appstatus")) {
     // } else if (strstr(topic, "status")) {
     // } else if (strstr(topic, "params")) {
     // }
-}
-
-static char* get_family(struct mg_str json) {
-    char* f = NULL;
-    if (json_scanf(json.p, json.len, "{fw_family: %Q}", &f) == 1)
-        return f;
-    else
-        return "A";
-}
-
-static bool is_gen1(char* family) {
-    // A B C D E H J K
-    return !strcmp(family, "A") || !strcmp(family, "B") || !strcmp(family, "C") || !strcmp(family, "D") ||
-           !strcmp(family, "E") || !strcmp(family, "H") || !strcmp(family, "J") || !strcmp(family, "K");
-}
-
-static bool is_gen2(char* family) {
-    // F G L M N P
-    return !strcmp(family, "F") || !strcmp(family, "G") || !strcmp(family, "L") || !strcmp(family, "M") ||
-           !strcmp(family, "N") || !strcmp(family, "P");
-}
-
-static bool twinkly_subscribe_cb(int idx, const struct mg_str* ip, const struct mg_str* json) {
-    LOG(LL_DEBUG, ("%s %.*s", __func__, ip->len, ip->p));
-    bool result = false;
-    if (!is_gen1(get_family(*json)))
-        return result;
-    char* str;
-    if (json_scanf(json->p, json->len, "{mac: %Q}", &str) == 1) {
-        unsigned char a[6];
-        int last = -1;
-        int rc = sscanf(str, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx%n", a + 0, a + 1, a + 2, a + 3, a + 4, a + 5, &last);
-        if (rc != 6 || 17 != last) {
-            LOG(LL_ERROR, ("Invalid mac address: %s", str));
-            return false;
-        }
-        char* topic = NULL;
-        // appstatus, status, params
-        mg_asprintf(&topic, 0, "xled/+/%02X%02X%02X%02X%02X%02X", a[0], a[1], a[2], a[3], a[4], a[5]);
-        mgos_mqtt_sub(topic, mqtt_handler, (void*) idx); /* Subscribe */
-        free(topic);
-        result = true;
-    }
-    return result;
-}
-
-static bool jstore_iterate_cb(
-        struct mgos_jstore* store,
-        int idx,
-        mgos_jstore_item_hnd_t hnd,
-        const struct mg_str* id,
-        const struct mg_str* data,
-        void* userdata) {
-    LOG(LL_DEBUG, ("%s %.*s", __func__, id->len, id->p));
-    mgos_twinkly_iterate_cb_t cb = userdata;
-    s_devices_number++;
-    return cb ? cb(idx, id, data) : true;
-    (void) store;
-    (void) idx;
-    (void) hnd;
-    (void) data;
-}
-
-static bool list_rpc_cb(
-        struct mgos_jstore* store,
-        int idx,
-        mgos_jstore_item_hnd_t hnd,
-        const struct mg_str* id,
-        const struct mg_str* data,
-        void* userdata) {
-    LOG(LL_DEBUG, ("%s %ld %p %p %p", __func__, (long) idx, id, data, userdata));
-    if (!id || !data || !userdata)
-        return false;
-    struct json_out* out = (struct json_out*) userdata;
-    if (idx)
-        json_printf(out, ",");
-    json_printf(out, "{%.*Q: %.*Q}", id->len, id->p, data->len, data->p);
-    return true;
-    (void) store;
-    (void) idx;
-    (void) hnd;
-    (void) data;
+    (void) c;
+    (void) userdata;
 }
 
 static void add_rpc_cb(void* data, void* arg) {
@@ -621,8 +1264,12 @@ static void set_mqtt_config_cb(void* data, void* arg) {
         LOG(LL_DEBUG, ("%s %ld %.*s", __func__, (long) hm->resp_code, hm->body.len, hm->body.p));
     else
         LOG(LL_ERROR, ("%s error", __func__));
-    if (device)
-        free((void*) device->post_data);
+    if (!device)
+        return;
+    // Restore after removal logs in again, no session is kept for an address that is not stored
+    if (twinkly_registry_find(device->ip) < 0)
+        twinkly_session_drop(device->ip);
+    free((void*) device->post_data);
     twinkly_device_free(device);
 }
 
@@ -643,6 +1290,13 @@ static void twinkly_set_mqtt_config(struct mg_str* ip, const char* server) {
     }
 }
 
+// For gen1 device only (current gen2 fw = 2.5.6), its messages are picked up by the xled/# subscription
+static void twinkly_device_added(int idx, struct mg_str* ip) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (dev && DEVICE_FAMILY(dev)->mqtt)
+        twinkly_set_mqtt_config(ip, mgos_sys_config_get_mqtt_server());
+}
+
 static void twinkly_add_cb(void* data, void* arg) {
     LOG(LL_DEBUG, ("%s %p %p", __func__, data, arg));
     struct http_message* hm = data;
@@ -658,11 +1312,8 @@ static void twinkly_add_cb(void* data, void* arg) {
         mgos_sys_config_set_twinkly_config_changed(true);
         mgos_sys_config_save(&mgos_sys_config, false, NULL);
         mgos_event_trigger(MGOS_TWINKLY_EV_ADDED, NULL);
-        // For gen1 device only (current gen2 fw = 2.5.6)
-        if (is_gen1(get_family(hm->body))) {
-            twinkly_set_mqtt_config(ip, mgos_sys_config_get_mqtt_server());
-            twinkly_subscribe_cb(idx, ip, &hm->body);
-        }
+        if (res == MGOS_TWINKLY_ERROR_OK)
+            twinkly_device_added(idx, ip);
     }
     if (cc && cc->cb)
         cc->cb((void*) res, cc->arg); // add_rpc_cb
@@ -671,15 +1322,55 @@ static void twinkly_add_cb(void* data, void* arg) {
     free(cc);
 }
 
-bool mgos_twinkly_get_product(char* code, struct mgos_twinkly_product** product) {
-    for (int i = 0; i < sizeof(twinkly_products) / sizeof(struct mgos_twinkly_product); i++)
-        if (strcmp((const char*) code, twinkly_products[i].product_code) == 0) {
-            *product = (struct mgos_twinkly_product*) &twinkly_products[i];
+#define PRODUCTS_NUMBER (sizeof(twinkly_products) / sizeof(struct twinkly_product_packed))
+
+static void twinkly_product_unpack(const struct twinkly_product_packed* pp, struct mgos_twinkly_product* p) {
+    p->product_code = pp->product_code;
+    p->commercial_name = pp->commercial_name;
+    p->firmware_family = twinkly_strings[pp->firmware_family];
+    p->device_family = twinkly_strings[pp->device_family];
+    p->led_profile = twinkly_strings[pp->led_profile];
+    p->led_number = pp->led_number;
+    p->default_name = twinkly_strings[pp->default_name];
+    p->layout_type = twinkly_strings[pp->layout_type];
+    p->pixel_shape = twinkly_strings[pp->pixel_shape];
+    p->mapping_allowed = pp->mapping_allowed;
+    p->join_fml = twinkly_strings[pp->join_fml];
+    p->sync_fml = twinkly_strings[pp->sync_fml];
+    p->bluetooth = pp->bluetooth;
+    p->microphone = pp->microphone;
+    p->icon = twinkly_strings[pp->icon];
+}
+
+bool mgos_twinkly_get_product(const char* code, struct mgos_twinkly_product* product) {
+    if (!code || !product)
+        return false;
+    // twinkly_products[] is sorted by product_code
+    int lo = 0, hi = PRODUCTS_NUMBER - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int cmp = strcmp(code, twinkly_products[mid].product_code);
+        if (cmp == 0) {
+            twinkly_product_unpack(&twinkly_products[mid], product);
             return true;
         }
+        if (cmp < 0)
+            hi = mid - 1;
+        else
+            lo = mid + 1;
+    }
     return false;
 }
 
+static bool twinkly_products_check(void) {
+    for (int i = 1; i < PRODUCTS_NUMBER; i++)
+        if (strcmp(twinkly_products[i - 1].product_code, twinkly_products[i].product_code) >= 0) {
+            LOG(LL_ERROR, ("Products catalog is not sorted at %s", twinkly_products[i].product_code));
+            return false;
+        }
+    return true;
+}
+
 static void info_rpc_cb(void* data, void* arg) {
     LOG(LL_DEBUG, ("%s %p %p", __func__, data, arg));
     struct mg_rpc_request_info* ri = arg;
@@ -696,8 +1387,9 @@ static void info_rpc_cb(void* data, void* arg) {
             mbuf_init(&fb, 100);
             char* product_code;
             if (json_scanf(json.p, json.len, "{product_code: %Q}", &product_code) == 1) {
-                struct mgos_twinkly_product* p = NULL;
-                if (mgos_twinkly_get_product(product_code, &p)) {
+                struct mgos_twinkly_product product;
+                const struct mgos_twinkly_product* p = &product;
+                if (mgos_twinkly_get_product(product_code, &product)) {
                     json_printf(
                             &out,
                             "{%.*s,product:{commercial_name:%Q,device_family:%Q,led_profile:%Q,led_number:%d,default_"
@@ -770,6 +1462,155 @@ void mgos_twinkly_add(struct mg_str* ip, tw_cb_t cb, void* arg) {
     http_request(ip, METHOD_GESTALT, cadd, NULL, NULL);
 }
 
+// Bulk add: probes complete in any order, results keep the request order
+struct add_many {
+    struct mgos_twinkly_add_result* results;
+    struct mg_str* gestalts; // probe replies, stored when all probes are done
+    int count;
+    int next; // next address to probe
+    int inflight;
+    int done;
+    int limit;
+    bool launching; // probes completing synchronously do not start more
+    mgos_twinkly_add_many_cb_t cb;
+    void* arg;
+};
+
+struct add_many_probe {
+    struct add_many* am;
+    int i;
+};
+
+static void add_many_free(struct add_many* am) {
+    for (int i = 0; i < am->count; i++) {
+        mg_strfree(&am->results[i].ip);
+        mg_strfree(&am->gestalts[i]);
+    }
+    free(am->results);
+    free(am->gestalts);
+    free(am);
+}
+
+// All probes are done, accepted devices go to flash with one store write and one config save
+static void add_many_commit(struct add_many* am) {
+    int first = s_devices_cnt, added = 0;
+    struct mgos_jstore* store = mgos_jstore_create(JSON_PATH, NULL);
+    if (!store)
+        LOG(LL_ERROR, ("Failed to open jstore %s", JSON_PATH));
+    for (int i = 0; i < am->count; i++) {
+        struct mgos_twinkly_add_result* r = &am->results[i];
+        if (r->res != MGOS_TWINKLY_ERROR_OK)
+            continue;
+        int idx;
+        r->res = store ? jstore_add_item(store, &r->ip, am->gestalts[i], &idx) : MGOS_TWINKLY_ERROR_JSTORE;
+        if (r->res == MGOS_TWINKLY_ERROR_OK)
+            added++;
+    }
+    if (added && !mgos_jstore_save(store, JSON_PATH, NULL)) {
+        LOG(LL_ERROR, ("Failed to save jstore %s", JSON_PATH));
+        // New registry entries are appended, dropping them all
+        while (s_devices_cnt > first)
+            registry_remove(s_devices_cnt - 1);
+        for (int i = 0; i < am->count; i++)
+            if (am->results[i].res == MGOS_TWINKLY_ERROR_OK)
+                am->results[i].res = MGOS_TWINKLY_ERROR_JSTORE;
+        added = 0;
+    }
+    if (store)
+        mgos_jstore_free(store);
+    if (added) {
+        mgos_sys_config_set_twinkly_config_changed(true);
+        mgos_sys_config_save(&mgos_sys_config, false, NULL);
+        for (int i = 0; i < am->count; i++) {
+            struct mgos_twinkly_add_result* r = &am->results[i];
+            if (r->res != MGOS_TWINKLY_ERROR_OK)
+                continue;
+            twinkly_device_added(twinkly_registry_find(r->ip), &r->ip);
+            mgos_event_trigger(MGOS_TWINKLY_EV_ADDED, NULL);
+        }
+    }
+    LOG(LL_INFO, ("Bulk add done, %d of %d devices added", added, am->count));
+    if (am->cb)
+        am->cb(am->results, am->count, am->arg);
+    add_many_free(am);
+}
+
+static void add_many_probe_next(struct add_many* am);
+
+static void add_many_probe_cb(void* data, void* arg) {
+    struct http_message* hm = data;
+    struct add_many_probe* p = arg;
+    struct add_many* am = p->am;
+    struct mgos_twinkly_add_result* r = &am->results[p->i];
+    if (!hm) {
+        r->res = MGOS_TWINKLY_ERROR_TIMEOUT;
+    } else if (hm->resp_code != 200) {
+        r->res = MGOS_TWINKLY_ERROR_RESPONSE;
+    } else {
+        am->gestalts[p->i] = mg_strdup(hm->body);
+        r->res = am->gestalts[p->i].p ? MGOS_TWINKLY_ERROR_OK : MGOS_TWINKLY_ERROR_MEM;
+    }
+    free(p);
+    am->inflight--;
+    am->done++;
+    add_many_probe_next(am);
+}
+
+static void add_many_probe_next(struct add_many* am) {
+    if (am->launching)
+        return;
+    am->launching = true;
+    while (am->next < am->count && am->inflight < am->limit) {
+        int i = am->next++;
+        struct add_many_probe* p = calloc(1, sizeof(struct add_many_probe));
+        struct cb_ctx* cc = calloc(1, sizeof(struct cb_ctx));
+        if (!p || !cc) {
+            free(p);
+            free(cc);
+            am->results[i].res = MGOS_TWINKLY_ERROR_MEM;
+            am->done++;
+            continue;
+        }
+        p->am = am;
+        p->i = i;
+        cc->cb = add_many_probe_cb;
+        cc->arg = p;
+        am->inflight++;
+        http_request(&am->results[i].ip, METHOD_GESTALT, cc, NULL, NULL);
+    }
+    am->launching = false;
+    if (am->done == am->count)
+        add_many_commit(am);
+}
+
+bool mgos_twinkly_add_many(const struct mg_str* ips, int count, int limit, mgos_twinkly_add_many_cb_t cb, void* arg) {
+    if (!ips || count <= 0 || count > MGOS_TWINKLY_ADD_MANY_MAX)
+        return false;
+    struct add_many* am = calloc(1, sizeof(struct add_many));
+    if (!am)
+        return false;
+    am->results = calloc(count, sizeof(struct mgos_twinkly_add_result));
+    am->gestalts = calloc(count, sizeof(struct mg_str));
+    if (!am->results || !am->gestalts) {
+        add_many_free(am);
+        return false;
+    }
+    am->count = count;
+    for (int i = 0; i < count; i++) {
+        am->results[i].ip = mg_strdup(ips[i]);
+        if (!am->results[i].ip.p) {
+            add_many_free(am);
+            return false;
+        }
+    }
+    am->limit = limit > 0 ? limit : MGOS_TWINKLY_ADD_LIMIT;
+    am->cb = cb;
+    am->arg = arg;
+    LOG(LL_INFO, ("Bulk add of %d devices, %d probes at a time", count, am->limit));
+    add_many_probe_next(am);
+    return true;
+}
+
 static void remove_rpc_cb(void* data, void* arg) {
     LOG(LL_DEBUG, ("%s %ld %p", __func__, (long) data, arg));
     struct mg_rpc_request_info* ri = arg;
@@ -812,18 +1653,24 @@ static void remove_rpc_cb(void* data, void* arg) {
     ri = NULL;
 }
 
-void mgos_twinkly_remove(struct mg_str* ip, tw_cb_t cb, void* arg) {
-    LOG(LL_DEBUG, (__func__));
-    int res = jstore_remove_device(ip);
+// Unbound device (empty ip) is only dropped from the store, its mqtt config can not be restored
+static void twinkly_remove(int idx, struct mg_str* ip, tw_cb_t cb, void* arg) {
+    int res = jstore_remove_device(idx);
     mgos_sys_config_set_twinkly_config_changed(true);
     mgos_sys_config_save(&mgos_sys_config, false, NULL);
     // Restoring mqtt config
-    twinkly_set_mqtt_config(ip, "mqtt.twinkly.com");
+    if (ip->len)
+        twinkly_set_mqtt_config(ip, "mqtt.twinkly.com");
     mgos_event_trigger(MGOS_TWINKLY_EV_REMOVED, NULL);
     if (cb)
         cb((void*) res, arg);
 }
 
+void mgos_twinkly_remove(struct mg_str* ip, tw_cb_t cb, void* arg) {
+    LOG(LL_DEBUG, (__func__));
+    twinkly_remove(twinkly_registry_find(*ip), ip, cb, arg);
+}
+
 void mgos_twinkly_info(struct mg_str* ip, tw_cb_t cb, void* arg) {
     LOG(LL_DEBUG, (__func__));
     struct cb_ctx* cc = calloc(1, sizeof(struct cb_ctx));
@@ -874,23 +1721,22 @@ static void
     LOG(LL_INFO, (__func__));
     struct mbuf fb;
 
-    struct mgos_jstore* store = mgos_jstore_create(JSON_PATH, NULL);
-    if (!store) {
-        LOG(LL_ERROR, ("Failed to open jstore %s", JSON_PATH));
-        mg_rpc_send_errorf(ri, 400, "failed to open jstore");
-        return;
-    };
-
     struct json_out out = JSON_OUT_MBUF(&fb);
     mbuf_init(&fb, 500);
     json_printf(&out, "[");
-    mgos_jstore_iterate(store, list_rpc_cb, &out);
+    for (int i = 0; i < s_devices_cnt; i++) {
+        struct twinkly_device* dev = &s_devices[i];
+        if (i)
+            json_printf(&out, ",");
+        // Unbound device is keyed by MAC until it gets an address again
+        struct mg_str key = DEVICE_UNBOUND(dev) ? dev->mac : dev->ip;
+        json_printf(&out, "{%.*Q: %.*Q}", key.len, key.p, dev->json.len, dev->json.p);
+    }
     json_printf(&out, "]");
 
     mg_rpc_send_responsef(ri, "%.*s", fb.len, fb.buf);
     ri = NULL;
 
-    mgos_jstore_free(store);
     mbuf_free(&fb);
 
     (void) cb_arg;
@@ -923,16 +1769,24 @@ static void
     LOG(LL_INFO, ("%s %.*s", __func__, args.len, args.p));
 
     char* ip = NULL;
+    char* mac = NULL;
 
-    json_scanf(args.p, args.len, "{ip: %Q}", &ip);
-    struct mg_str* aip = calloc(1, sizeof(struct mg_str));
-    *aip = mg_strdup(mg_mk_str(ip));
-
+    json_scanf(args.p, args.len, "{ip: %Q, mac: %Q}", &ip, &mac);
     if (ip) {
-        mgos_twinkly_remove(aip, remove_rpc_cb, ri);
+        struct mg_str aip = mg_mk_str(ip);
+        mgos_twinkly_remove(&aip, remove_rpc_cb, ri);
+    } else if (mac) {
+        // Unbound devices have no address, MAC is the only key then
+        int idx = twinkly_registry_find_mac(mg_mk_str(mac));
+        struct twinkly_device* dev = twinkly_registry_get(idx);
+        struct mg_str aip = mg_strdup(dev ? dev->ip : mg_mk_str(""));
+        twinkly_remove(idx, &aip, remove_rpc_cb, ri);
+        mg_strfree(&aip);
     } else
-        mg_rpc_send_errorf(ri, 400, "IP address is required (a.b.c.d)");
+        mg_rpc_send_errorf(ri, 400, "IP address (a.b.c.d) or MAC is required");
 
+    free(ip);
+    free(mac);
     ri = NULL;
 
     (void) cb_arg;
@@ -984,19 +1838,205 @@ static void
     (void) fi;
 }
 
-bool mgos_twinkly_iterate(mgos_twinkly_iterate_cb_t cb) {
-    struct mgos_jstore* store = mgos_jstore_create(JSON_PATH, NULL);
-    if (!store) {
-        LOG(LL_ERROR, ("Failed to open jstore %s", JSON_PATH));
-        return false;
+static void add_many_rpc_cb(const struct mgos_twinkly_add_result* results, int count, void* arg) {
+    struct mg_rpc_request_info* ri = arg;
+    struct mbuf fb;
+    struct json_out out = JSON_OUT_MBUF(&fb);
+    mbuf_init(&fb, 100);
+    json_printf(&out, "[");
+    for (int i = 0; i < count; i++) {
+        const struct mgos_twinkly_add_result* r = &results[i];
+        json_printf(
+                &out,
+                "%s{ip: %.*Q, success: %B, error: %d}",
+                i ? "," : "",
+                r->ip.len,
+                r->ip.p,
+                r->res == MGOS_TWINKLY_ERROR_OK,
+                r->res);
     }
-    s_devices_number = 0;
-    if (!mgos_jstore_iterate(store, jstore_iterate_cb, (void*) cb)) {
-        LOG(LL_ERROR, ("Failed to load data from jstore"));
-        return false;
+    json_printf(&out, "]");
+    mg_rpc_send_responsef(ri, "%.*s", fb.len, fb.buf);
+    mbuf_free(&fb);
+}
+
+// Host addresses of a.b.c.d/n, network and broadcast addresses are skipped below /31
+static int add_many_cidr(const char* cidr, struct mg_str** ips) {
+    unsigned int a, b, c, d, n;
+    int len = 0;
+    if (sscanf(cidr, "%u.%u.%u.%u/%u%n", &a, &b, &c, &d, &n, &len) != 5 || cidr[len] != '\0' || a > 255 ||
+        b > 255 || c > 255 || d > 255 || n > 32)
+        return -1;
+    uint64_t size = 1ULL << (32 - n);
+    int hosts = (int) (n >= 31 ? size : size - 2);
+    if (size > MGOS_TWINKLY_ADD_MANY_MAX + 2)
+        return -1;
+    uint32_t mask = n ? 0xFFFFFFFFU << (32 - n) : 0;
+    uint32_t addr = ((a << 24) | (b << 16) | (c << 8) | d) & mask;
+    if (n < 31)
+        addr++;
+    *ips = calloc(hosts, sizeof(struct mg_str));
+    if (!*ips)
+        return -1;
+    for (int i = 0; i < hosts; i++, addr++) {
+        char ip[16];
+        snprintf(ip, sizeof(ip), "%u.%u.%u.%u", addr >> 24, (addr >> 16) & 0xFF, (addr >> 8) & 0xFF, addr & 0xFF);
+        (*ips)[i] = mg_strdup(mg_mk_str(ip));
     }
-    mgos_jstore_free(store);
-    LOG(LL_DEBUG, ("%ld devices iterated", (long) s_devices_number));
+    return hosts;
+}
+
+static void add_many_handler(
+        struct mg_rpc_request_info* ri, void* cb_arg, struct mg_rpc_frame_info* fi, struct mg_str args) {
+    LOG(LL_INFO, ("%s %.*s", __func__, args.len, args.p));
+
+    char* cidr = NULL;
+    int limit = 0;
+    struct mg_str* ips = NULL;
+    int count = 0;
+    json_scanf(args.p, args.len, "{cidr: %Q, limit: %d}", &cidr, &limit);
+    if (cidr) {
+        count = add_many_cidr(cidr, &ips);
+        if (count < 0) {
+            mg_rpc_send_errorf(ri, 400, "invalid range, up to %d addresses", MGOS_TWINKLY_ADD_MANY_MAX);
+            goto clean;
+        }
+    } else {
+        // Address tokens point into args, mgos_twinkly_add_many() copies them
+        struct json_token t;
+        while (json_scanf_array_elem(args.p, args.len, ".ips", count, &t) > 0)
+            count++;
+        ips = count > 0 ? calloc(count, sizeof(struct mg_str)) : NULL;
+        for (int i = 0; ips && i < count; i++)
+            if (json_scanf_array_elem(args.p, args.len, ".ips", i, &t) > 0)
+                ips[i] = mg_mk_str_n(t.ptr, t.len);
+    }
+    if (!ips || count == 0 || count > MGOS_TWINKLY_ADD_MANY_MAX) {
+        mg_rpc_send_errorf(ri, 400, "ips or cidr required, up to %d addresses", MGOS_TWINKLY_ADD_MANY_MAX);
+        goto clean;
+    }
+    if (!mgos_twinkly_add_many(ips, count, limit, add_many_rpc_cb, ri))
+        mg_rpc_send_errorf(ri, MGOS_TWINKLY_ERROR_MEM, "out of memory");
+clean:
+    if (cidr)
+        for (int i = 0; ips && i < count; i++)
+            mg_strfree(&ips[i]);
+    free(ips);
+    free(cidr);
+    ri = NULL;
+
+    (void) cb_arg;
+    (void) fi;
+}
+
+static void state_json(struct json_out* out, const struct twinkly_device* dev) {
+    const struct mgos_twinkly_state* s = &dev->state;
+    json_printf(
+            out,
+            "{ip: %.*Q, mac: %.*Q, online: %B, online_ts: %.3f, mode: %d, mode_ts: %.3f, brightness: %d, "
+            "brightness_ts: %.3f}",
+            dev->ip.len,
+            dev->ip.p,
+            dev->mac.len,
+            dev->mac.p,
+            s->online,
+            s->online_ts,
+            s->mode,
+            s->mode_ts,
+            s->brightness,
+            s->brightness_ts);
+}
+
+static void
+        state_handler(struct mg_rpc_request_info* ri, void* cb_arg, struct mg_rpc_frame_info* fi, struct mg_str args) {
+    LOG(LL_DEBUG, ("%s %.*s", __func__, args.len, args.p));
+
+    char* ip = NULL;
+    char* mac = NULL;
+    struct mbuf fb;
+    struct json_out out = JSON_OUT_MBUF(&fb);
+    mbuf_init(&fb, 100);
+    json_scanf(args.p, args.len, "{ip: %Q, mac: %Q}", &ip, &mac);
+    if (ip || mac) {
+        int idx = ip ? twinkly_registry_find(mg_mk_str(ip)) : twinkly_registry_find_mac(mg_mk_str(mac));
+        struct twinkly_device* dev = twinkly_registry_get(idx);
+        if (!dev) {
+            mg_rpc_send_errorf(ri, MGOS_TWINKLY_ERROR_EXISTS, "not exists");
+            goto clean;
+        }
+        state_json(&out, dev);
+    } else {
+        json_printf(&out, "[");
+        for (int i = 0; i < s_devices_cnt; i++) {
+            if (i)
+                json_printf(&out, ",");
+            state_json(&out, &s_devices[i]);
+        }
+        json_printf(&out, "]");
+    }
+    mg_rpc_send_responsef(ri, "%.*s", fb.len, fb.buf);
+clean:
+    mbuf_free(&fb);
+    free(ip);
+    free(mac);
+    ri = NULL;
+
+    (void) cb_arg;
+    (void) fi;
+}
+
+static void discover_rpc_cb(const struct mgos_twinkly_discovered* devices, int count, void* arg) {
+    struct mg_rpc_request_info* ri = arg;
+    struct mbuf fb;
+    struct json_out out = JSON_OUT_MBUF(&fb);
+    mbuf_init(&fb, 100);
+    json_printf(&out, "[");
+    for (int i = 0; i < count; i++) {
+        const struct mgos_twinkly_discovered* d = &devices[i];
+        if (i)
+            json_printf(&out, ",");
+        json_printf(
+                &out,
+                "{ip: %.*Q, name: %.*Q, known: %B",
+                d->ip.len,
+                d->ip.p,
+                d->name.len,
+                d->name.p,
+                d->known);
+        if (d->add_result >= 0)
+            json_printf(&out, ", added: %B, error: %d", d->add_result == MGOS_TWINKLY_ERROR_OK, d->add_result);
+        json_printf(&out, "}");
+    }
+    json_printf(&out, "]");
+    mg_rpc_send_responsef(ri, "%.*s", fb.len, fb.buf);
+    mbuf_free(&fb);
+}
+
+static void discover_handler(
+        struct mg_rpc_request_info* ri, void* cb_arg, struct mg_rpc_frame_info* fi, struct mg_str args) {
+    LOG(LL_INFO, ("%s %.*s", __func__, args.len, args.p));
+
+    float timeout = 0;
+    bool add = false;
+    json_scanf(args.p, args.len, "{timeout: %f, add: %B}", &timeout, &add);
+    if (!mgos_twinkly_discover(timeout, add, discover_rpc_cb, ri))
+        mg_rpc_send_errorf(ri, MGOS_TWINKLY_ERROR_MEM, "failed to start discovery");
+
+    ri = NULL;
+
+    (void) cb_arg;
+    (void) fi;
+}
+
+bool mgos_twinkly_iterate(mgos_twinkly_iterate_cb_t cb) {
+    int i;
+    for (i = 0; i < s_devices_cnt; i++) {
+        struct twinkly_device* dev = &s_devices[i];
+        LOG(LL_DEBUG, ("%s %.*s", __func__, dev->ip.len, dev->ip.p));
+        if (cb && !cb(i, &dev->ip, &dev->json))
+            break;
+    }
+    LOG(LL_DEBUG, ("%ld devices iterated", (long) i));
     return true;
 }
 
@@ -1018,8 +2058,68 @@ static void cloud_cb(int ev, void* evd, void* arg) {
 }
 
 int mgos_twinkly_count() {
-    mgos_twinkly_iterate(NULL);
-    return s_devices_number;
+    return s_devices_cnt;
+}
+
+bool mgos_twinkly_get_state(int idx, struct mgos_twinkly_state* state) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !state)
+        return false;
+    *state = dev->state;
+    return true;
+}
+
+// led/mode first, then brightness over the same session, replies update the cache
+static void state_refresh_cb(void* data, void* arg) {
+    struct async_ctx* device = arg;
+    if (data && strcmp(device->method, METHOD_LED_MODE) == 0) {
+        twinkly_device_request(device, METHOD_LED_OUT_BRIGHTNESS, NULL, state_refresh_cb, NULL);
+        return;
+    }
+    twinkly_device_free(device);
+}
+
+bool mgos_twinkly_state_refresh(int idx) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev) {
+        LOG(LL_ERROR, ("Failed to get device %ld", (long) idx));
+        return false;
+    }
+    if (DEVICE_UNBOUND(dev)) {
+        LOG(LL_ERROR, ("%.*s - device has no address, waiting for re-resolution", dev->mac.len, dev->mac.p));
+        return false;
+    }
+    struct async_ctx* device = twinkly_device_new(dev->ip);
+    if (!device)
+        return false;
+    twinkly_device_request(device, METHOD_LED_MODE, NULL, state_refresh_cb, NULL);
+    return true;
+}
+
+// Polling refreshes one device per tick, spread over the interval
+static void state_poll_cb(void* arg) {
+    int interval_ms = mgos_sys_config_get_twinkly_state_poll() * 1000;
+    int tick = s_devices_cnt > 0 ? interval_ms / s_devices_cnt : interval_ms;
+    tick = tick > STATE_POLL_TICK_MIN_MS ? tick : STATE_POLL_TICK_MIN_MS;
+    s_poll_timer = mgos_set_timer(tick, 0, state_poll_cb, NULL);
+    if (s_devices_cnt == 0)
+        return;
+    if (s_poll_next >= s_devices_cnt) {
+        s_poll_next = 0;
+        s_poll_round++;
+    }
+    int idx = s_poll_next++;
+    // Unbound device has nothing to poll, its address comes back from discovery
+    if (DEVICE_UNBOUND(&s_devices[idx])) {
+        twinkly_resolve();
+        return;
+    }
+    // Known offline device mostly times out, still probed now and then to see it back
+    struct mgos_twinkly_state* s = &s_devices[idx].state;
+    if (s->online_ts && !s->online && s_poll_round % STATE_POLL_OFFLINE_ROUNDS != 0)
+        return;
+    mgos_twinkly_state_refresh(idx);
+    (void) arg;
 }
 
 static void set_mode_cb(void* data, void* arg) {
@@ -1051,54 +2151,40 @@ static void set_mode_cb(void* data, void* arg) {
 }
 
 bool mgos_twinkly_set_mode(int idx, bool mode) {
-    struct mgos_jstore* store = mgos_jstore_create(JSON_PATH, NULL);
-    if (!store) {
-        LOG(LL_ERROR, ("Failed to open jstore %s", JSON_PATH));
-        return false;
-    }
     bool res = false;
-    mgos_jstore_item_hnd_t hnd;
-    struct mg_str ip, json;
-    if (mgos_jstore_item_get(store, MGOS_JSTORE_REF_BY_INDEX(idx), &ip, &json, &hnd, NULL, NULL)) {
-        char* mode_off = "{\"mode\":\"off\"}";
-        char* mode_on = "{\"mode\":\"effect\"}"; // default value
-        char* family = get_family(json);
-        if (is_gen1(family))
-            mode_on = "{\"mode\":\"movie\"}";
-        if (is_gen2(family))
-            mode_on = "{\"mode\":\"playlist\"}";
-        twinkly_device_request(twinkly_device_new(ip), METHOD_LED_MODE, mode ? mode_on : mode_off, set_mode_cb, NULL);
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (dev && DEVICE_UNBOUND(dev)) {
+        LOG(LL_ERROR, ("%.*s - device has no address, waiting for re-resolution", dev->mac.len, dev->mac.p));
+    } else if (dev) {
+        const char* mode_off = "{\"mode\":\"off\"}";
+        const char* mode_on = DEVICE_FAMILY(dev)->mode_on;
+        twinkly_device_request(
+                twinkly_device_new(dev->ip), METHOD_LED_MODE, mode ? mode_on : mode_off, set_mode_cb, NULL);
         res = true;
     } else {
-        LOG(LL_ERROR, ("Failed to get item %ld from jstore", (long) idx));
+        LOG(LL_ERROR, ("Failed to get device %ld", (long) idx));
     }
-    mgos_jstore_free(store);
     return res;
 }
 
 bool mgos_twinkly_set_brightness(int idx, int value) {
-    struct mgos_jstore* store = mgos_jstore_create(JSON_PATH, NULL);
-    if (!store) {
-        LOG(LL_ERROR, ("Failed to open jstore %s", JSON_PATH));
-        return false;
-    }
     bool res = false;
-    mgos_jstore_item_hnd_t hnd;
-    struct mg_str ip;
-    if (mgos_jstore_item_get(store, MGOS_JSTORE_REF_BY_INDEX(idx), &ip, NULL, &hnd, NULL, NULL)) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (dev && DEVICE_UNBOUND(dev)) {
+        LOG(LL_ERROR, ("%.*s - device has no address, waiting for re-resolution", dev->mac.len, dev->mac.p));
+    } else if (dev) {
         char* data = NULL;
         mg_asprintf(&data, 0, "{\"type\":\"A\",\"value\":%ld}", (long) value);
         twinkly_device_request(
-                twinkly_device_new(ip),
+                twinkly_device_new(dev->ip),
                 METHOD_LED_OUT_BRIGHTNESS,
                 data,
                 NULL, // contex auto free
                 NULL);
         res = true;
     } else {
-        LOG(LL_ERROR, ("Failed to get item %ld from jstore", (long) idx));
+        LOG(LL_ERROR, ("Failed to get device %ld", (long) idx));
     }
-    mgos_jstore_free(store);
     return res;
 }
 
@@ -1117,28 +2203,41 @@ clean:
         fclose(fp);
         fp = NULL;
     }
-    s_devices_number = 0;
+    registry_clear();
 }
 
 // Libarary
 bool mgos_twinkly_init(void) {
     if (!mgos_sys_config_get_twinkly_enable())
         return true;
-    // MQTT subscribe for gen1
-    mgos_twinkly_iterate(twinkly_subscribe_cb);
+    twinkly_products_check();
+    registry_load();
+    // MQTT for gen1: appstatus, status, params of all devices, dispatched by MAC
+    mgos_mqtt_sub(MQTT_TOPIC, mqtt_handler, NULL);
+    twinkly_heartbeat_init();
+    if (mgos_sys_config_get_twinkly_state_poll() > 0)
+        s_poll_timer = mgos_set_timer(STATE_POLL_TICK_MIN_MS, 0, state_poll_cb, NULL);
     mgos_event_add_handler(MGOS_EVENT_CLOUD_CONNECTED, cloud_cb, NULL);
     mgos_event_add_handler(MGOS_EVENT_CLOUD_DISCONNECTED, cloud_cb, NULL);
     if (mgos_sys_config_get_twinkly_rpc_enable()) {
         struct mg_rpc* c = mgos_rpc_get_global();
         mg_rpc_add_handler(c, "Twinkly.List", "{}", list_handler, NULL);
         mg_rpc_add_handler(c, "Twinkly.Add", "{ip:%Q}", add_handler, NULL);
-        mg_rpc_add_handler(c, "Twinkly.Remove", "{ip:%Q}", remove_handler, NULL);
+        mg_rpc_add_handler(c, "Twinkly.AddMany", "{ips:[%Q], cidr:%Q, limit:%d}", add_many_handler, NULL);
+        mg_rpc_add_handler(c, "Twinkly.Remove", "{ip:%Q, mac:%Q}", remove_handler, NULL);
         mg_rpc_add_handler(c, "Twinkly.Info", "{ip:%Q}", info_handler, NULL);
         mg_rpc_add_handler(c, "Twinkly.Call", "{ip:%Q, method:%Q, data:%Q}", call_handler, NULL);
+        mg_rpc_add_handler(c, "Twinkly.Discover", "{timeout:%f, add:%B}", discover_handler, NULL);
+        mg_rpc_add_handler(c, "Twinkly.State", "{ip:%Q, mac:%Q}", state_handler, NULL);
     }
     return true;
 }
 
 void mgos_twinkly_deinit(void) {
-    //
+    twinkly_heartbeat_deinit();
+    mgos_clear_timer(s_poll_timer);
+    s_poll_timer = MGOS_INVALID_TIMER_ID;
+    twinkly_conns_close();
+    twinkly_sessions_free();
+    registry_clear();
 }
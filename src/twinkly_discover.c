@@ -0,0 +1,191 @@
+/*
+ * Copyright 2020 d4rkmen <darkmen@i.ua>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mgos.h"
+#include "mgos_twinkly.h"
+#include "twinkly_internal.h"
+
+// UDP discovery: "\x01discover" broadcast to port 5555,
+// reply is IP address (4 bytes, reversed), "OK" and zero terminated device name
+
+#define DISCOVER_REQUEST     "\x01discover"
+#define DISCOVER_REPLY_MIN   6 // IP, "OK"
+#define DISCOVER_RETRIES     3 // broadcasts within the window, datagrams get lost
+#define DISCOVER_DEVICES_MAX 64
+
+struct twinkly_discover {
+    struct mg_connection* c;
+    mgos_timer_id timer;
+    int ticks; // broadcasts sent
+    double timeout;
+    bool add;
+    int adding; // adds in progress
+    struct mgos_twinkly_discovered* devices;
+    int count;
+    mgos_twinkly_discover_cb_t cb;
+    void* arg;
+};
+
+struct discover_add_ctx {
+    struct twinkly_discover* d;
+    int i;
+};
+
+static void discover_free(struct twinkly_discover* d) {
+    for (int i = 0; i < d->count; i++) {
+        mg_strfree(&d->devices[i].ip);
+        mg_strfree(&d->devices[i].name);
+    }
+    free(d->devices);
+    free(d);
+}
+
+static void discover_finish(struct twinkly_discover* d) {
+    LOG(LL_INFO, ("Discovery done, %d devices found", d->count));
+    if (d->cb)
+        d->cb(d->devices, d->count, d->arg);
+    discover_free(d);
+}
+
+// Reply parsing, duplicates (several broadcasts, several interfaces) are merged by IP
+static void discover_reply(struct twinkly_discover* d, const uint8_t* buf, size_t len) {
+    if (len < DISCOVER_REPLY_MIN || buf[4] != 'O' || buf[5] != 'K')
+        return;
+    char ip[16];
+    snprintf(ip, sizeof(ip), "%u.%u.%u.%u", buf[3], buf[2], buf[1], buf[0]);
+    struct mg_str sip = mg_mk_str(ip);
+    for (int i = 0; i < d->count; i++)
+        if (mg_strcmp(d->devices[i].ip, sip) == 0)
+            return;
+    if (d->count >= DISCOVER_DEVICES_MAX)
+        return;
+    struct mgos_twinkly_discovered* devices =
+            realloc(d->devices, (d->count + 1) * sizeof(struct mgos_twinkly_discovered));
+    if (!devices)
+        return;
+    d->devices = devices;
+    struct mgos_twinkly_discovered* dev = &d->devices[d->count++];
+    memset(dev, 0, sizeof(*dev));
+    size_t name_len = strnlen((const char*) buf + DISCOVER_REPLY_MIN, len - DISCOVER_REPLY_MIN);
+    dev->ip = mg_strdup(sip);
+    dev->name = mg_strdup(mg_mk_str_n((const char*) buf + DISCOVER_REPLY_MIN, name_len));
+    dev->known = twinkly_registry_find(sip) >= 0;
+    dev->add_result = -1;
+    LOG(LL_DEBUG, ("Discovered %s %.*s%s", ip, dev->name.len, dev->name.p, dev->known ? " (known)" : ""));
+}
+
+static void discover_ev_handler(struct mg_connection* c, int ev, void* p, void* user_data) {
+    struct twinkly_discover* d = user_data;
+    switch (ev) {
+        case MG_EV_RECV: {
+            if (d)
+                discover_reply(d, (const uint8_t*) c->recv_mbuf.buf, c->recv_mbuf.len);
+            mbuf_remove(&c->recv_mbuf, c->recv_mbuf.len);
+            break;
+        }
+        case MG_EV_CLOSE: {
+            if (d)
+                d->c = NULL;
+            break;
+        }
+    }
+    (void) p;
+}
+
+static void discover_add_cb(void* data, void* arg) {
+    struct discover_add_ctx* ac = arg;
+    struct twinkly_discover* d = ac->d;
+    d->devices[ac->i].add_result = (int) (intptr_t) data;
+    free(ac);
+    if (--d->adding == 0)
+        discover_finish(d);
+}
+
+// Window is over, adding new devices if requested
+static void discover_close(struct twinkly_discover* d) {
+    if (d->c) {
+        d->c->user_data = NULL;
+        d->c->flags |= MG_F_CLOSE_IMMEDIATELY;
+        d->c = NULL;
+    }
+    if (d->add) {
+        // Counting self, so adds completing synchronously do not finish early
+        d->adding = 1;
+        for (int i = 0; i < d->count; i++) {
+            if (d->devices[i].known)
+                continue;
+            struct discover_add_ctx* ac = calloc(1, sizeof(struct discover_add_ctx));
+            struct mg_str* ip = calloc(1, sizeof(struct mg_str));
+            if (!ac || !ip) {
+                free(ac);
+                free(ip);
+                d->devices[i].add_result = MGOS_TWINKLY_ERROR_MEM;
+                continue;
+            }
+            ac->d = d;
+            ac->i = i;
+            *ip = mg_strdup(d->devices[i].ip);
+            d->adding++;
+            mgos_twinkly_add(ip, discover_add_cb, ac);
+        }
+        if (--d->adding > 0)
+            return;
+    }
+    discover_finish(d);
+}
+
+static void discover_timer_cb(void* arg) {
+    struct twinkly_discover* d = arg;
+    if (d->ticks >= DISCOVER_RETRIES || !d->c) {
+        mgos_clear_timer(d->timer);
+        d->timer = MGOS_INVALID_TIMER_ID;
+        discover_close(d);
+        return;
+    }
+    mg_send(d->c, DISCOVER_REQUEST, sizeof(DISCOVER_REQUEST) - 1);
+    d->ticks++;
+}
+
+bool mgos_twinkly_discover(double timeout_s, bool add, mgos_twinkly_discover_cb_t cb, void* arg) {
+    struct twinkly_discover* d = calloc(1, sizeof(struct twinkly_discover));
+    if (!d)
+        return false;
+    d->timeout = timeout_s > 0 ? timeout_s : MGOS_TWINKLY_DISCOVER_TIMEOUT_S;
+    d->add = add;
+    d->cb = cb;
+    d->arg = arg;
+    char addr[32];
+    snprintf(addr, sizeof(addr), "udp://255.255.255.255:%d", MGOS_TWINKLY_DISCOVER_PORT);
+    d->c = mg_connect(mgos_get_mgr(), addr, discover_ev_handler, d);
+    if (!d->c) {
+        LOG(LL_ERROR, ("Failed to open discovery socket"));
+        free(d);
+        return false;
+    }
+#if MG_NET_IF == MG_NET_IF_SOCKET
+    int on = 1;
+    setsockopt(d->c->sock, SOL_SOCKET, SO_BROADCAST, (const char*) &on, sizeof(on));
+#endif
+    // Broadcasts are spread over the window, the last tick closes it
+    discover_timer_cb(d);
+    d->timer = mgos_set_timer((int) (d->timeout * 1000 / DISCOVER_RETRIES), MGOS_TIMER_REPEAT, discover_timer_cb, d);
+    LOG(LL_INFO, ("Discovery started, %.1f s", d->timeout));
+    return true;
+}
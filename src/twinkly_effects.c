@@ -0,0 +1,281 @@
+/*
+ * Copyright 2020 d4rkmen <darkmen@i.ua>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mgos.h"
+#include "mgos_twinkly.h"
+
+// Procedural effects, integer math only: sine, color wheel and heat palette come from tables
+// built once, per LED work is a few adds, shifts and lookups.
+
+#define EFFECT_COST_EWMA 8 // render cost average weight, 1/N
+
+#define SCALE8(c, v) ((uint8_t)(((uint16_t)(c) * ((uint16_t)(v) + 1)) >> 8))
+#define QADD8(a, b)  ((uint8_t)((a) + (b) > 255 ? 255 : (a) + (b)))
+#define QSUB8(a, b)  ((uint8_t)((a) > (b) ? (a) - (b) : 0))
+
+struct mgos_twinkly_effect;
+
+typedef void (*effect_fn_t)(struct mgos_twinkly_effect* e, uint8_t* rgb, int leds);
+
+struct mgos_twinkly_effect {
+    enum mgos_twinkly_effect_type type;
+    struct mgos_twinkly_effect_params params;
+    uint32_t phase; // 1/16 units, advanced by speed every frame
+    uint32_t seed;  // xorshift state
+    // Per LED state: fire heat, twinkle level and hue
+    int leds;
+    uint8_t* state;
+    uint8_t* state2;
+    bool warned;
+    struct mgos_twinkly_effect_stats stats;
+};
+
+static uint8_t s_sin8[256];     // 128 + 127 * sin(2 * pi * i / 256)
+static uint8_t s_wheel[256][3]; // fully saturated hue
+static uint8_t s_heat[256][3];  // black - red - yellow - white
+static bool s_tables_ready = false;
+
+static void effect_tables_init(void) {
+    if (s_tables_ready)
+        return;
+    for (int i = 0; i < 256; i++) {
+        // Bhaskara approximation on a half period, t = 0..128 is 0..pi
+        int t = i & 127;
+        int p = t * (128 - t);
+        int v = 127 * 4 * p / (20480 - p);
+        s_sin8[i] = (uint8_t)(i < 128 ? 128 + v : 128 - v);
+        // Six sectors of 43 steps
+        int region = i / 43, rem = (i - region * 43) * 6;
+        uint8_t up = (uint8_t)(rem > 255 ? 255 : rem), down = 255 - up;
+        uint8_t* c = s_wheel[i];
+        const uint8_t sectors[6][3] = {
+            { 255, up, 0 }, { down, 255, 0 }, { 0, 255, up }, { 0, down, 255 }, { up, 0, 255 }, { 255, 0, down },
+        };
+        memcpy(c, sectors[region < 6 ? region : 5], 3);
+        // Heat in three ramps
+        int t192 = i * 191 / 255;
+        uint8_t ramp = (uint8_t)((t192 & 63) << 2);
+        uint8_t* h = s_heat[i];
+        h[0] = t192 >= 64 ? 255 : ramp;
+        h[1] = t192 >= 128 ? 255 : t192 >= 64 ? ramp : 0;
+        h[2] = t192 >= 128 ? ramp : 0;
+    }
+    s_tables_ready = true;
+}
+
+static inline uint32_t effect_rand(struct mgos_twinkly_effect* e) {
+    uint32_t x = e->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return e->seed = x;
+}
+
+// Hue step per LED in 1/256 hue units, density cycles over the strip
+static uint32_t effect_hue_step(uint8_t density, int leds) {
+    return (uint32_t)(density ? density : 1) * 65536 / (uint32_t) leds;
+}
+
+static void effect_rainbow(struct mgos_twinkly_effect* e, uint8_t* rgb, int leds) {
+    uint32_t step = effect_hue_step(e->params.density, leds);
+    uint32_t h = ((e->phase >> 4) + e->params.hue) << 8;
+    for (int i = 0; i < leds; i++, h += step) {
+        const uint8_t* c = s_wheel[(h >> 8) & 0xFF];
+        rgb[i * 3 + 0] = c[0];
+        rgb[i * 3 + 1] = c[1];
+        rgb[i * 3 + 2] = c[2];
+    }
+}
+
+static void effect_gradient(struct mgos_twinkly_effect* e, uint8_t* rgb, int leds) {
+    uint32_t step = effect_hue_step(e->params.density, leds);
+    uint32_t a = (e->phase >> 4) << 8;
+    int from = e->params.hue, span = (int) e->params.hue2 - from;
+    for (int i = 0; i < leds; i++, a += step) {
+        // Sine sweep from hue to hue2 and back
+        int t = s_sin8[(a >> 8) & 0xFF];
+        const uint8_t* c = s_wheel[(uint8_t)(from + ((span * t) >> 8))];
+        rgb[i * 3 + 0] = c[0];
+        rgb[i * 3 + 1] = c[1];
+        rgb[i * 3 + 2] = c[2];
+    }
+}
+
+static void effect_chase(struct mgos_twinkly_effect* e, uint8_t* rgb, int leds) {
+    int size = e->params.size ? e->params.size : 1;
+    int period = size + e->params.density;
+    const uint8_t* c = s_wheel[e->params.hue];
+    // Segment tail fades linearly, position within period is tracked without a divide per LED
+    int k = (int) ((e->phase >> 4) % (uint32_t) period);
+    k = k ? period - k : 0;
+    int fade = 255 / size;
+    for (int i = 0; i < leds; i++) {
+        uint8_t v = k < size ? (uint8_t)(255 - k * fade) : 0;
+        rgb[i * 3 + 0] = SCALE8(c[0], v);
+        rgb[i * 3 + 1] = SCALE8(c[1], v);
+        rgb[i * 3 + 2] = SCALE8(c[2], v);
+        if (++k == period)
+            k = 0;
+    }
+}
+
+static void effect_twinkle(struct mgos_twinkly_effect* e, uint8_t* rgb, int leds) {
+    uint8_t* level = e->state;
+    uint8_t* hue = e->state2;
+    uint8_t decay = 1 + (e->params.speed >> 4);
+    // Spawn chance per LED per frame is density / 4096
+    uint32_t chance = (uint32_t) e->params.density << 4;
+    for (int i = 0; i < leds; i++) {
+        if (level[i]) {
+            level[i] = QSUB8(level[i], decay);
+        } else {
+            uint32_t r = effect_rand(e);
+            if ((r & 0xFFFF) < chance) {
+                level[i] = 255;
+                hue[i] = (uint8_t)(e->params.hue + ((r >> 16) & 31) - 16);
+            }
+        }
+        const uint8_t* c = s_wheel[hue[i]];
+        rgb[i * 3 + 0] = SCALE8(c[0], level[i]);
+        rgb[i * 3 + 1] = SCALE8(c[1], level[i]);
+        rgb[i * 3 + 2] = SCALE8(c[2], level[i]);
+    }
+}
+
+// Heat diffusion upwards from random sparks at the bottom, first LED is the bottom
+static void effect_fire(struct mgos_twinkly_effect* e, uint8_t* rgb, int leds) {
+    uint8_t* heat = e->state;
+    uint32_t cooling = (uint32_t)(e->params.size ? e->params.size : 55) * 10 / (uint32_t) leds + 2;
+    for (int i = 0; i < leds; i++)
+        heat[i] = QSUB8(heat[i], effect_rand(e) % cooling);
+    for (int i = leds - 1; i >= 2; i--)
+        heat[i] = (uint8_t)((heat[i - 1] + 2 * heat[i - 2]) / 3);
+    uint32_t r = effect_rand(e);
+    if ((r & 0xFF) < (e->params.density ? e->params.density : 120)) {
+        int y = (int) ((r >> 8) % (uint32_t)(leds < 7 ? leds : 7));
+        heat[y] = QADD8(heat[y], 160 + ((r >> 16) % 96));
+    }
+    for (int i = 0; i < leds; i++) {
+        const uint8_t* c = s_heat[heat[i]];
+        rgb[i * 3 + 0] = c[0];
+        rgb[i * 3 + 1] = c[1];
+        rgb[i * 3 + 2] = c[2];
+    }
+}
+
+// Budgets are ESP32 at 240 MHz figures with some headroom
+static const struct {
+    effect_fn_t fn;
+    uint32_t budget_us; // per 1000 LEDs
+    bool state;         // needs per LED state
+} s_effects[] = {
+    [MGOS_TWINKLY_EFFECT_RAINBOW] = { effect_rainbow, 300, false },
+    [MGOS_TWINKLY_EFFECT_FIRE] = { effect_fire, 1200, true },
+    [MGOS_TWINKLY_EFFECT_TWINKLE] = { effect_twinkle, 600, true },
+    [MGOS_TWINKLY_EFFECT_CHASE] = { effect_chase, 250, false },
+    [MGOS_TWINKLY_EFFECT_GRADIENT] = { effect_gradient, 400, false },
+};
+
+#define EFFECTS_NUMBER (sizeof(s_effects) / sizeof(s_effects[0]))
+
+struct mgos_twinkly_effect* mgos_twinkly_effect_new(
+        enum mgos_twinkly_effect_type type, const struct mgos_twinkly_effect_params* params) {
+    if ((unsigned) type >= EFFECTS_NUMBER) {
+        LOG(LL_ERROR, ("Unknown effect %d", (int) type));
+        return NULL;
+    }
+    struct mgos_twinkly_effect* e = calloc(1, sizeof(struct mgos_twinkly_effect));
+    if (!e)
+        return NULL;
+    effect_tables_init();
+    e->type = type;
+    e->seed = (uint32_t) mgos_uptime_micros() | 1;
+    e->stats.budget_us = s_effects[type].budget_us;
+    mgos_twinkly_effect_set_params(e, params);
+    return e;
+}
+
+void mgos_twinkly_effect_set_params(struct mgos_twinkly_effect* e, const struct mgos_twinkly_effect_params* params) {
+    if (!e)
+        return;
+    if (params)
+        e->params = *params;
+    else
+        memset(&e->params, 0, sizeof(e->params));
+    if (!e->params.speed)
+        e->params.speed = 16;
+}
+
+// Per LED state follows the frame size
+static bool effect_state(struct mgos_twinkly_effect* e, int leds) {
+    if (!s_effects[e->type].state || e->leds == leds)
+        return true;
+    free(e->state);
+    free(e->state2);
+    e->state = calloc(leds, 1);
+    e->state2 = calloc(leds, 1);
+    e->leds = e->state && e->state2 ? leds : 0;
+    return e->leds != 0;
+}
+
+bool mgos_twinkly_effect_render(uint8_t* rgb, size_t len, void* arg) {
+    struct mgos_twinkly_effect* e = arg;
+    int leds = (int) (len / 3);
+    if (!e || !rgb || leds <= 0 || !effect_state(e, leds))
+        return false;
+    int64_t start = mgos_uptime_micros();
+    s_effects[e->type].fn(e, rgb, leds);
+    e->phase += e->params.speed;
+    // Cost is normalized to 1000 LEDs to compare with the budget
+    uint32_t cost = (uint32_t) ((mgos_uptime_micros() - start) * 1000 / leds);
+    struct mgos_twinkly_effect_stats* s = &e->stats;
+    s->frames++;
+    if (s->frames == 1)
+        s->cost_avg_us = cost;
+    else
+        s->cost_avg_us += ((int32_t) cost - (int32_t) s->cost_avg_us) / EFFECT_COST_EWMA;
+    if (cost > s->cost_max_us)
+        s->cost_max_us = cost;
+    if (cost > s->budget_us)
+        s->over_budget++;
+    if (s->cost_avg_us > s->budget_us && !e->warned) {
+        LOG(LL_WARN,
+            ("Effect %d over budget: %lu of %lu us per 1000 leds",
+             (int) e->type,
+             (unsigned long) s->cost_avg_us,
+             (unsigned long) s->budget_us));
+        e->warned = true;
+    }
+    return true;
+}
+
+bool mgos_twinkly_effect_get_stats(struct mgos_twinkly_effect* e, struct mgos_twinkly_effect_stats* stats) {
+    if (!e || !stats)
+        return false;
+    *stats = e->stats;
+    return true;
+}
+
+void mgos_twinkly_effect_free(struct mgos_twinkly_effect* e) {
+    if (!e)
+        return;
+    free(e->state);
+    free(e->state2);
+    free(e);
+}
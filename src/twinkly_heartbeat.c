@@ -0,0 +1,122 @@
+/*
+ * Copyright 2020 d4rkmen <darkmen@i.ua>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mgos.h"
+#include "mgos_twinkly.h"
+#include "twinkly_internal.h"
+
+// Liveness: the discovery datagram is sent to one device per tick, ticks are spread so every
+// device is pinged once per interval. Reply carries the device address, no TCP, no auth.
+
+#define HEARTBEAT_REQUEST     "\x01discover"
+#define HEARTBEAT_REPLY_MIN   6  // IP, "OK"
+#define HEARTBEAT_TICK_MIN_MS 50 // large lists are pinged slower than the interval
+
+static struct mg_connection* s_hb_conn = NULL;
+static mgos_timer_id s_hb_timer = MGOS_INVALID_TIMER_ID;
+static int s_hb_next = 0; // round robin cursor
+
+static void heartbeat_status(int idx, struct twinkly_device* dev, bool online) {
+    if (twinkly_state_set(idx, MGOS_TWINKLY_EV_STATUS, online))
+        LOG(LL_INFO, ("%.*s - %s", dev->ip.len, dev->ip.p, online ? "online" : "offline"));
+}
+
+static void heartbeat_ev_handler(struct mg_connection* c, int ev, void* p, void* user_data) {
+    switch (ev) {
+        case MG_EV_RECV: {
+            const uint8_t* buf = (const uint8_t*) c->recv_mbuf.buf;
+            if (c->recv_mbuf.len >= HEARTBEAT_REPLY_MIN && buf[4] == 'O' && buf[5] == 'K') {
+                char ip[16];
+                snprintf(ip, sizeof(ip), "%u.%u.%u.%u", buf[3], buf[2], buf[1], buf[0]);
+                int idx = twinkly_registry_find(mg_mk_str(ip));
+                struct twinkly_device* dev = twinkly_registry_get(idx);
+                if (dev) {
+                    dev->hb_pending = false;
+                    dev->hb_misses = 0;
+                    heartbeat_status(idx, dev, true);
+                }
+            }
+            mbuf_remove(&c->recv_mbuf, c->recv_mbuf.len);
+            break;
+        }
+        case MG_EV_CLOSE: {
+            if (s_hb_conn == c)
+                s_hb_conn = NULL;
+            break;
+        }
+    }
+    (void) p;
+    (void) user_data;
+}
+
+static void heartbeat_timer_cb(void* arg) {
+    int count = mgos_twinkly_count();
+    int interval_ms = mgos_sys_config_get_twinkly_heartbeat() * 1000;
+    int tick = count > 0 ? interval_ms / count : interval_ms;
+    tick = tick > HEARTBEAT_TICK_MIN_MS ? tick : HEARTBEAT_TICK_MIN_MS;
+    s_hb_timer = mgos_set_timer(tick, 0, heartbeat_timer_cb, NULL);
+    if (count == 0)
+        return;
+    if (s_hb_next >= count)
+        s_hb_next = 0;
+    int idx = s_hb_next++;
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    // Unbound device has nothing to ping, its address comes back from discovery
+    if (DEVICE_UNBOUND(dev)) {
+        twinkly_resolve();
+        return;
+    }
+    // Previous ping is still unanswered
+    if (dev->hb_pending && dev->hb_misses < UINT8_MAX &&
+        ++dev->hb_misses >= mgos_sys_config_get_twinkly_heartbeat_misses())
+        heartbeat_status(idx, dev, false);
+    char ip[16];
+    unsigned int a, b, c, d;
+    snprintf(ip, sizeof(ip), "%.*s", (int) dev->ip.len, dev->ip.p);
+    if (sscanf(ip, "%u.%u.%u.%u", &a, &b, &c, &d) != 4)
+        return;
+    if (!s_hb_conn) {
+        char addr[32];
+        snprintf(addr, sizeof(addr), "udp://%s:%d", ip, MGOS_TWINKLY_DISCOVER_PORT);
+        s_hb_conn = mg_connect(mgos_get_mgr(), addr, heartbeat_ev_handler, NULL);
+        if (!s_hb_conn)
+            return;
+    }
+    // Single socket for all devices, UDP send goes out immediately to the current peer address
+    s_hb_conn->sa.sin.sin_addr.s_addr = htonl((a << 24) | (b << 16) | (c << 8) | d);
+    mg_send(s_hb_conn, HEARTBEAT_REQUEST, sizeof(HEARTBEAT_REQUEST) - 1);
+    dev->hb_pending = true;
+    (void) arg;
+}
+
+void twinkly_heartbeat_init(void) {
+    if (mgos_sys_config_get_twinkly_heartbeat() <= 0 || s_hb_timer != MGOS_INVALID_TIMER_ID)
+        return;
+    s_hb_timer = mgos_set_timer(HEARTBEAT_TICK_MIN_MS, 0, heartbeat_timer_cb, NULL);
+}
+
+void twinkly_heartbeat_deinit(void) {
+    mgos_clear_timer(s_hb_timer);
+    s_hb_timer = MGOS_INVALID_TIMER_ID;
+    if (s_hb_conn) {
+        s_hb_conn->flags |= MG_F_CLOSE_IMMEDIATELY;
+        s_hb_conn = NULL;
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright 2020 d4rkmen <darkmen@i.ua>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "mgos.h"
+#include "mgos_twinkly.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define METHOD_GESTALT            "gestalt"
+#define METHOD_LOGIN              "login"
+#define METHOD_LOGOUT             "logout"
+#define METHOD_VERIFY             "verify"
+#define METHOD_STATUS             "status"
+#define METHOD_SUMMARY            "summary"
+#define METHOD_DEVICE_NAME        "device_name"
+#define METHOD_LED_MODE           "led/mode"
+#define METHOD_LED_CONFIG         "led/config"
+#define METHOD_LED_DRIVER_PARAMS  "led/driver_params"
+#define METHOD_LED_RESET          "led/reset"
+#define METHOD_LED_OUT_BRIGHTNESS "led/out/brightness"
+#define METHOD_LED_MODE_CONFIG    "led/movie/config"
+#define METHOD_LED_MOVIE_FULL     "led/movie/full"
+#define METHOD_FW_VERSION         "fw/version"
+#define METHOD_TIMER              "timer"
+#define METHOD_NETWORK_SCAN       "network/scan"
+#define METHOD_NETWORK_STATUS     "network/status"
+#define METHOD_MQTT_CONFIG        "mqtt/config"
+
+// Firmware family capabilities, resolved once per device on load / add
+struct twinkly_family {
+    const char* name; // gestalt fw_family
+    uint8_t gen;      // 0 - unknown
+    const char* mode_on;
+    bool mqtt;        // custom MQTT broker support
+    uint8_t rt_proto; // led/rt/frame UDP protocol version
+    uint8_t max_bpl;  // max bytes per LED
+};
+
+extern const struct twinkly_family twinkly_families[];
+
+struct twinkly_rt;
+struct twinkly_layout;
+
+// Stored device record
+struct twinkly_device {
+    struct mg_str mac;               // jstore key, lower case
+    struct mg_str ip;                // current address, "_ip" in the record
+    struct mg_str json;              // gestalt
+    uint8_t family;                  // twinkly_families index
+    struct twinkly_rt* rt;           // realtime output, NULL if not started
+    struct twinkly_layout* layout;   // led/layout/full, NULL if not fetched
+    uint8_t timeouts;                // consecutive HTTP failures
+    struct mgos_twinkly_state state; // cached, see twinkly_state_set()
+    bool hb_pending;                 // heartbeat sent, no reply yet
+    uint8_t hb_misses;               // consecutive unanswered heartbeats
+};
+
+#define DEVICE_FAMILY(dev) (&twinkly_families[(dev)->family])
+#define DEVICE_UNBOUND(dev) ((dev)->ip.len == 0) // address moved to another record, see RESOLVE_TIMEOUTS
+
+// Device registry
+struct twinkly_device* twinkly_registry_get(int idx);
+int twinkly_registry_find(struct mg_str ip);
+int twinkly_registry_find_mac(struct mg_str mac);
+// Rate limited discovery, rebinds moved devices to their new addresses
+void twinkly_resolve(void);
+// Set stored record field to JSON value, saved to flash, returns MGOS_TWINKLY_ERROR_x
+int twinkly_device_edit(int idx, const char* json_path, const char* value);
+// Cache update from MQTT, replies or heartbeat, MGOS_TWINKLY_EV_x is raised on change, true if changed
+bool twinkly_state_set(int idx, int ev, int value);
+// Gestalt and store, ip is heap allocated and freed by the call, cb gets (void*) MGOS_TWINKLY_ERROR_x
+void mgos_twinkly_add(struct mg_str* ip, tw_cb_t cb, void* arg);
+
+// Device requests, authenticated with the cached session token
+struct async_ctx* twinkly_device_new(struct mg_str ip);
+void twinkly_device_free(struct async_ctx* device);
+void twinkly_device_request(struct async_ctx* device, char* method, const char* post_data, tw_cb_t cb, void* arg);
+
+// Realtime
+void twinkly_rt_token_update(struct twinkly_device* dev, struct mg_str auth_token);
+void twinkly_rt_free(struct twinkly_rt* rt);
+
+// Layout
+void twinkly_layout_free(struct twinkly_layout* layout);
+
+// Liveness heartbeat
+void twinkly_heartbeat_init(void);
+void twinkly_heartbeat_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
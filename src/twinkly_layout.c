@@ -0,0 +1,245 @@
+/*
+ * Copyright 2020 d4rkmen <darkmen@i.ua>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mgos.h"
+#include "mgos_twinkly.h"
+#include "twinkly_internal.h"
+
+#define METHOD_LED_LAYOUT_FULL "led/layout/full"
+
+// LED coordinates, structure of arrays in MGOS_TWINKLY_LAYOUT_ONE fixed point
+struct twinkly_layout {
+    int leds;
+    int16_t* x; // -1 .. 1
+    int16_t* y; // 0 .. 1, bottom to top
+    int16_t* z; // -1 .. 1
+    // Image sampling map, cached for the last image size
+    int map_w;
+    int map_h;
+    uint32_t* map; // pixel index per LED
+};
+
+struct layout_fetch_ctx {
+    tw_cb_t cb;
+    void* arg;
+};
+
+struct layout_parse_ctx {
+    struct twinkly_layout* layout;
+    int count;
+};
+
+static struct twinkly_layout* layout_new(int leds) {
+    struct twinkly_layout* l = calloc(1, sizeof(struct twinkly_layout));
+    if (!l)
+        return NULL;
+    l->leds = leds;
+    l->x = calloc(leds, sizeof(int16_t));
+    l->y = calloc(leds, sizeof(int16_t));
+    l->z = calloc(leds, sizeof(int16_t));
+    if (!l->x || !l->y || !l->z) {
+        twinkly_layout_free(l);
+        return NULL;
+    }
+    return l;
+}
+
+void twinkly_layout_free(struct twinkly_layout* l) {
+    if (!l)
+        return;
+    free(l->x);
+    free(l->y);
+    free(l->z);
+    free(l->map);
+    free(l);
+}
+
+static int16_t layout_fixed(const struct json_token* token) {
+    char buf[24];
+    int len = token->len < (int) sizeof(buf) - 1 ? token->len : (int) sizeof(buf) - 1;
+    memcpy(buf, token->ptr, len);
+    buf[len] = '\0';
+    double v = strtod(buf, NULL);
+    v = v < -1.99 ? -1.99 : v > 1.99 ? 1.99 : v;
+    return (int16_t)(v * MGOS_TWINKLY_LAYOUT_ONE);
+}
+
+// Single pass over the response, coordinates[N].x / .y / .z
+static void layout_walk_cb(
+        void* callback_data,
+        const char* name,
+        size_t name_len,
+        const char* path,
+        const struct json_token* token) {
+    struct layout_parse_ctx* ctx = callback_data;
+    if (token->type != JSON_TYPE_NUMBER || name_len != 1 || strncmp(path, ".coordinates[", 13) != 0)
+        return;
+    int i = atoi(path + 13);
+    if (i < 0 || i >= ctx->layout->leds)
+        return;
+    switch (name[0]) {
+        case 'x':
+            ctx->layout->x[i] = layout_fixed(token);
+            break;
+        case 'y':
+            ctx->layout->y[i] = layout_fixed(token);
+            break;
+        case 'z':
+            ctx->layout->z[i] = layout_fixed(token);
+            break;
+        default:
+            return;
+    }
+    // Any coordinate counts, z is missing in 2D layouts
+    if (i >= ctx->count)
+        ctx->count = i + 1;
+}
+
+static void layout_fetch_cb(void* data, void* arg) {
+    LOG(LL_DEBUG, ("%s %p %p", __func__, data, arg));
+    struct http_message* hm = data;
+    struct async_ctx* device = arg;
+    struct layout_fetch_ctx* cc = device->arg;
+    int res = MGOS_TWINKLY_ERROR_OK;
+    // Device record could be removed or moved meanwhile
+    struct twinkly_device* dev = twinkly_registry_get(twinkly_registry_find(device->ip));
+    if (!hm) {
+        res = MGOS_TWINKLY_ERROR_TIMEOUT;
+    } else if (hm->resp_code != 200 || !dev) {
+        LOG(LL_ERROR, ("%.*s - layout error %ld", device->ip.len, device->ip.p, (long) hm->resp_code));
+        res = MGOS_TWINKLY_ERROR_RESPONSE;
+    } else {
+        int leds = 0;
+        json_scanf(dev->json.p, dev->json.len, "{number_of_led: %d}", &leds);
+        struct layout_parse_ctx ctx = { .layout = leds > 0 ? layout_new(leds) : NULL };
+        if (!ctx.layout) {
+            res = MGOS_TWINKLY_ERROR_MEM;
+        } else {
+            json_walk(hm->body.p, hm->body.len, layout_walk_cb, &ctx);
+            if (ctx.count != leds) {
+                LOG(LL_ERROR, ("%.*s - layout has %d of %d leds", device->ip.len, device->ip.p, ctx.count, leds));
+                twinkly_layout_free(ctx.layout);
+                res = MGOS_TWINKLY_ERROR_RESPONSE;
+            } else {
+                twinkly_layout_free(dev->layout);
+                dev->layout = ctx.layout;
+                LOG(LL_INFO, ("%.*s - layout cached, %d leds", device->ip.len, device->ip.p, leds));
+            }
+        }
+    }
+    if (cc && cc->cb)
+        cc->cb((void*) res, cc->arg);
+    free(cc);
+    twinkly_device_free(device);
+}
+
+bool mgos_twinkly_layout_fetch(int idx, tw_cb_t cb, void* arg) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev) {
+        LOG(LL_ERROR, ("Failed to get device %ld", (long) idx));
+        return false;
+    }
+    if (DEVICE_UNBOUND(dev)) {
+        LOG(LL_ERROR, ("%.*s - device has no address, waiting for re-resolution", dev->mac.len, dev->mac.p));
+        if (cb)
+            cb((void*) MGOS_TWINKLY_ERROR_UNBOUND, arg);
+        return true;
+    }
+    if (dev->layout) {
+        if (cb)
+            cb((void*) MGOS_TWINKLY_ERROR_OK, arg);
+        return true;
+    }
+    struct layout_fetch_ctx* cc = calloc(1, sizeof(struct layout_fetch_ctx));
+    struct async_ctx* device = twinkly_device_new(dev->ip);
+    if (!cc || !device) {
+        free(cc);
+        if (device)
+            twinkly_device_free(device);
+        return false;
+    }
+    cc->cb = cb;
+    cc->arg = arg;
+    twinkly_device_request(device, METHOD_LED_LAYOUT_FULL, NULL, layout_fetch_cb, cc);
+    return true;
+}
+
+bool mgos_twinkly_layout_get(int idx, const int16_t** x, const int16_t** y, const int16_t** z, int* leds) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !dev->layout)
+        return false;
+    if (x)
+        *x = dev->layout->x;
+    if (y)
+        *y = dev->layout->y;
+    if (z)
+        *z = dev->layout->z;
+    if (leds)
+        *leds = dev->layout->leds;
+    return true;
+}
+
+// Pixel index per LED, recomputed only when image size changes
+static bool layout_map(struct twinkly_layout* l, int w, int h) {
+    if (l->map && l->map_w == w && l->map_h == h)
+        return true;
+    uint32_t* map = realloc(l->map, l->leds * sizeof(uint32_t));
+    if (!map)
+        return false;
+    l->map = map;
+    l->map_w = w;
+    l->map_h = h;
+    const int32_t one = MGOS_TWINKLY_LAYOUT_ONE;
+    for (int i = 0; i < l->leds; i++) {
+        // x -1..1 left to right, y 0..1 bottom to top, image rows go top to bottom
+        int32_t u = ((l->x[i] + one) * (w - 1)) / (2 * one);
+        int32_t v = ((one - l->y[i]) * (h - 1)) / one;
+        u = u < 0 ? 0 : u >= w ? w - 1 : u;
+        v = v < 0 ? 0 : v >= h ? h - 1 : v;
+        map[i] = (uint32_t)(v * w + u);
+    }
+    return true;
+}
+
+bool mgos_twinkly_layout_sample_image(int idx, const uint8_t* image, int w, int h, uint8_t* rgb) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !dev->layout || !image || w <= 0 || h <= 0)
+        return false;
+    struct twinkly_layout* l = dev->layout;
+    if (!layout_map(l, w, h))
+        return false;
+    const uint32_t* map = l->map;
+    for (int i = 0; i < l->leds; i++) {
+        const uint8_t* px = image + map[i] * 3;
+        rgb[i * 3 + 0] = px[0];
+        rgb[i * 3 + 1] = px[1];
+        rgb[i * 3 + 2] = px[2];
+    }
+    return true;
+}
+
+bool mgos_twinkly_layout_sample_field(int idx, mgos_twinkly_field_fn_t fn, void* arg, uint8_t* rgb) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !dev->layout || !fn)
+        return false;
+    struct twinkly_layout* l = dev->layout;
+    fn(l->x, l->y, l->z, l->leds, rgb, arg);
+    return true;
+}
@@ -0,0 +1,648 @@
+/*
+ * Copyright 2020 d4rkmen <darkmen@i.ua>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mgos.h"
+#include "mgos_twinkly.h"
+#include "twinkly_internal.h"
+
+// Movie upload: led/mode off -> led/movie/full (streamed) -> led/movie/config -> led/mode movie.
+// Body is produced frame by frame while the socket drains, so only one frame is kept in RAM.
+// Content hash of the last uploaded movie is kept in the device record, when it and led/movie/config
+// match, the transfer is skipped: led/movie/config (GET) -> led/mode movie.
+
+#define MOVIE_SEND_WATERMARK  2048                   // refill send buffer below this level
+#define MOVIE_PROGRESS_S      0.5                    // progress report interval
+#define MOVIE_FANOUT_TMP_PATH "twinkly_movie.%u.tmp" // numbered, concurrent fan-outs get own files
+#define MOVIE_HASH_PATH       "._movie"              // device record field
+#define MOVIE_FNV_OFFSET      0xcbf29ce484222325ULL
+#define MOVIE_FNV_PRIME       0x100000001b3ULL
+
+struct twinkly_movie_upload {
+    struct mg_str ip;
+    struct async_ctx* device; // REST requests, holds auth token for the stream
+    struct mg_connection* c;  // led/movie/full stream
+    // Source
+    FILE* fp;
+    mgos_twinkly_movie_frame_fn_t gen;
+    void* gen_arg;
+    mgos_twinkly_pixel_fn_t convert;
+    uint8_t* rgb;   // generator output
+    uint8_t* frame; // wire format
+    size_t frame_size;
+    int leds;
+    int frames;
+    int frame_delay_ms;
+    int frame_next;     // next frame to produce
+    size_t header_left; // request header bytes not sent yet
+    char* config;       // led/movie/config request body
+    bool replied;       // led/movie/full accepted
+    uint64_t hash;      // content hash, frames and frame delay
+    int res;
+    struct mgos_twinkly_movie_progress progress;
+    double last_progress;
+    mgos_twinkly_movie_progress_cb_t progress_cb;
+    tw_cb_t cb;
+    void* arg;
+};
+
+static void movie_upload_free(struct twinkly_movie_upload* up) {
+    if (up->fp)
+        fclose(up->fp);
+    if (up->device)
+        twinkly_device_free(up->device);
+    mg_strfree(&up->ip);
+    free(up->rgb);
+    free(up->frame);
+    free(up->config);
+    free(up);
+}
+
+static void movie_progress_update(struct mgos_twinkly_movie_progress* p, double now) {
+    p->elapsed_s = now - p->started;
+    p->bytes_per_s = p->elapsed_s > 0 ? (uint32_t)(p->bytes_sent / p->elapsed_s) : 0;
+}
+
+static void movie_progress_report(struct twinkly_movie_upload* up, bool force) {
+    double now = mg_time();
+    if (!up->progress_cb || (!force && now - up->last_progress < MOVIE_PROGRESS_S))
+        return;
+    up->last_progress = now;
+    movie_progress_update(&up->progress, now);
+    up->progress_cb(&up->ip, &up->progress, up->arg);
+}
+
+static void movie_upload_done(struct twinkly_movie_upload* up, int res) {
+    up->progress.done = true;
+    // Final figures are logged even without a progress callback
+    movie_progress_update(&up->progress, mg_time());
+    movie_progress_report(up, true);
+    LOG(res == MGOS_TWINKLY_ERROR_OK ? LL_INFO : LL_ERROR,
+        ("%.*s - movie upload %s, %lu bytes in %.2f s",
+         up->ip.len,
+         up->ip.p,
+         res == MGOS_TWINKLY_ERROR_OK ? "done" : "failed",
+         (unsigned long) up->progress.bytes_sent,
+         up->progress.elapsed_s));
+    if (up->cb)
+        up->cb((void*) res, up->arg);
+    movie_upload_free(up);
+}
+
+// Next frame in wire format, false on source error
+static bool movie_frame_read(struct twinkly_movie_upload* up) {
+    if (up->fp)
+        return fread(up->frame, 1, up->frame_size, up->fp) == up->frame_size;
+    if (!up->gen(up->frame_next, up->rgb, up->leds * 3, up->gen_arg))
+        return false;
+    up->convert(up->rgb, up->frame, up->leds);
+    return true;
+}
+
+static void movie_stream_fill(struct twinkly_movie_upload* up, struct mg_connection* c) {
+    while (c->send_mbuf.len < MOVIE_SEND_WATERMARK && up->frame_next < up->frames) {
+        if (!movie_frame_read(up)) {
+            LOG(LL_ERROR, ("%.*s - movie frame %d read error", up->ip.len, up->ip.p, up->frame_next));
+            up->res = MGOS_TWINKLY_ERROR_MEM;
+            c->flags |= MG_F_CLOSE_IMMEDIATELY;
+            return;
+        }
+        mg_send(c, up->frame, up->frame_size);
+        up->frame_next++;
+    }
+}
+
+static void movie_config_cb(void* data, void* arg);
+
+static void movie_stream_handler(struct mg_connection* c, int ev, void* p, void* user_data) {
+    struct twinkly_movie_upload* up = user_data;
+    if (!up)
+        return;
+    switch (ev) {
+        case MG_EV_CONNECT: {
+            int err = *(int*) p;
+            if (err) {
+                LOG(LL_ERROR, ("%.*s - connect error %d", up->ip.len, up->ip.p, err));
+                up->res = MGOS_TWINKLY_ERROR_TIMEOUT;
+                c->flags |= MG_F_CLOSE_IMMEDIATELY;
+                break;
+            }
+            up->header_left = mg_printf(
+                    c,
+                    "POST /xled/v1/%s HTTP/1.1\r\nHost: %.*s\r\nConnection: close\r\nX-Auth-Token: %.*s\r\n"
+                    "Content-Type: application/octet-stream\r\nContent-Length: %lu\r\n\r\n",
+                    METHOD_LED_MOVIE_FULL,
+                    up->ip.len,
+                    up->ip.p,
+                    up->device->auth_token.len,
+                    up->device->auth_token.p,
+                    (unsigned long) up->progress.bytes_total);
+            movie_stream_fill(up, c);
+            mg_set_timer(c, mg_time() + MGOS_TWINKLY_HTTP_TIMEOUT_S);
+            break;
+        };
+        case MG_EV_SEND: {
+            int sent = *(int*) p;
+            if (sent <= 0)
+                break;
+            // Progress counts body bytes only
+            size_t header = (size_t) sent < up->header_left ? (size_t) sent : up->header_left;
+            up->header_left -= header;
+            up->progress.bytes_sent += sent - header;
+            movie_stream_fill(up, c);
+            movie_progress_report(up, false);
+            mg_set_timer(c, mg_time() + MGOS_TWINKLY_HTTP_TIMEOUT_S);
+            break;
+        };
+        case MG_EV_HTTP_REPLY: {
+            struct http_message* hm = (struct http_message*) p;
+            int code = 0;
+            LOG(LL_DEBUG, ("%.*s", hm->body.len, hm->body.p));
+            json_scanf(hm->body.p, hm->body.len, "{code: %d}", &code);
+            if (hm->resp_code == 200 && code == 1000)
+                up->replied = true;
+            else
+                up->res = MGOS_TWINKLY_ERROR_RESPONSE;
+            c->flags |= MG_F_CLOSE_IMMEDIATELY;
+            break;
+        };
+        case MG_EV_TIMER: {
+            LOG(LL_ERROR, ("%.*s - movie upload timed out", up->ip.len, up->ip.p));
+            up->res = MGOS_TWINKLY_ERROR_TIMEOUT;
+            c->flags |= MG_F_CLOSE_IMMEDIATELY;
+            break;
+        };
+        case MG_EV_CLOSE: {
+            c->user_data = NULL;
+            up->c = NULL;
+            if (!up->replied) {
+                movie_upload_done(up, up->res != MGOS_TWINKLY_ERROR_OK ? up->res : MGOS_TWINKLY_ERROR_RESPONSE);
+                break;
+            }
+            up->progress.bytes_sent = up->progress.bytes_total;
+            mg_asprintf(
+                    &up->config,
+                    0,
+                    "{\"frame_delay\":%d,\"leds_number\":%d,\"frames_number\":%d}",
+                    up->frame_delay_ms,
+                    up->leds,
+                    up->frames);
+            if (!up->config) {
+                movie_upload_done(up, MGOS_TWINKLY_ERROR_MEM);
+                break;
+            }
+            twinkly_device_request(up->device, METHOD_LED_MODE_CONFIG, up->config, movie_config_cb, up);
+            break;
+        };
+    }
+}
+
+// Checks REST reply, finishes upload on error
+static bool movie_reply_ok(struct http_message* hm, struct twinkly_movie_upload* up, const char* step) {
+    int code = 0;
+    if (!hm) {
+        movie_upload_done(up, MGOS_TWINKLY_ERROR_TIMEOUT);
+        return false;
+    }
+    if (hm->resp_code != 200 || json_scanf(hm->body.p, hm->body.len, "{code: %d}", &code) != 1 || code != 1000) {
+        LOG(LL_ERROR, ("%.*s - %s error %ld, code %ld", up->ip.len, up->ip.p, step, (long) hm->resp_code, (long) code));
+        movie_upload_done(up, MGOS_TWINKLY_ERROR_RESPONSE);
+        return false;
+    }
+    return true;
+}
+
+static void movie_mode_cb(void* data, void* arg) {
+    LOG(LL_DEBUG, ("%s %p %p", __func__, data, arg));
+    struct async_ctx* device = arg;
+    struct twinkly_movie_upload* up = device->arg;
+    if (!movie_reply_ok(data, up, "movie mode"))
+        return;
+    if (!up->progress.skipped) {
+        char value[24];
+        snprintf(value, sizeof(value), "\"%016llx\"", (unsigned long long) up->hash);
+        if (twinkly_device_edit(twinkly_registry_find(up->ip), MOVIE_HASH_PATH, value) != MGOS_TWINKLY_ERROR_OK)
+            LOG(LL_WARN, ("%.*s - failed to store movie hash", up->ip.len, up->ip.p));
+    }
+    movie_upload_done(up, MGOS_TWINKLY_ERROR_OK);
+}
+
+static void movie_config_cb(void* data, void* arg) {
+    LOG(LL_DEBUG, ("%s %p %p", __func__, data, arg));
+    struct async_ctx* device = arg;
+    struct twinkly_movie_upload* up = device->arg;
+    if (movie_reply_ok(data, up, "movie config"))
+        twinkly_device_request(device, METHOD_LED_MODE, "{\"mode\":\"movie\"}", movie_mode_cb, up);
+}
+
+// Device is off and the session token is known, starting the stream
+static void movie_off_cb(void* data, void* arg) {
+    LOG(LL_DEBUG, ("%s %p %p", __func__, data, arg));
+    struct async_ctx* device = arg;
+    struct twinkly_movie_upload* up = device->arg;
+    if (!movie_reply_ok(data, up, "mode off"))
+        return;
+    char* addr = NULL;
+    mg_asprintf(&addr, 0, "tcp://%.*s:80", up->ip.len, up->ip.p);
+    up->c = addr ? mg_connect(mgos_get_mgr(), addr, movie_stream_handler, up) : NULL;
+    free(addr);
+    if (!up->c) {
+        movie_upload_done(up, MGOS_TWINKLY_ERROR_MEM);
+        return;
+    }
+    mg_set_protocol_http_websocket(up->c);
+    mg_set_timer(up->c, mg_time() + MGOS_TWINKLY_HTTP_TIMEOUT_S);
+}
+
+// Frame geometry from gestalt, convert is NULL if led_profile does not match bytes per LED
+static bool movie_led_config(struct twinkly_device* dev, int* leds, int* bpl, mgos_twinkly_pixel_fn_t* convert) {
+    char* led_profile = NULL;
+    *leds = 0;
+    *bpl = 3;
+    json_scanf(
+            dev->json.p,
+            dev->json.len,
+            "{number_of_led: %d, bytes_per_led: %d, led_profile: %Q}",
+            leds,
+            bpl,
+            &led_profile);
+    int profile_bpl = 0;
+    *convert = mgos_twinkly_pixel_get_fn(led_profile ? led_profile : "RGB", &profile_bpl);
+    if (profile_bpl != *bpl)
+        *convert = NULL;
+    free(led_profile);
+    return *leds > 0 && *bpl > 0;
+}
+
+// FNV-1a 64 over wire format frames, source is rewound afterwards
+static bool movie_hash(struct twinkly_movie_upload* up, uint64_t* hash) {
+    uint64_t h = MOVIE_FNV_OFFSET;
+    for (up->frame_next = 0; up->frame_next < up->frames; up->frame_next++) {
+        if (!movie_frame_read(up))
+            return false;
+        for (size_t i = 0; i < up->frame_size; i++)
+            h = (h ^ up->frame[i]) * MOVIE_FNV_PRIME;
+    }
+    up->frame_next = 0;
+    if (up->fp)
+        rewind(up->fp);
+    // Same frames at another speed is another movie
+    *hash = (h ^ (uint64_t) up->frame_delay_ms) * MOVIE_FNV_PRIME;
+    return true;
+}
+
+// Cached movie check: device led/movie/config has to describe the same frames
+static void movie_cached_config_cb(void* data, void* arg) {
+    LOG(LL_DEBUG, ("%s %p %p", __func__, data, arg));
+    struct http_message* hm = data;
+    struct async_ctx* device = arg;
+    struct twinkly_movie_upload* up = device->arg;
+    if (!hm) {
+        movie_upload_done(up, MGOS_TWINKLY_ERROR_TIMEOUT);
+        return;
+    }
+    int frame_delay = 0, leds_number = 0, frames_number = 0;
+    json_scanf(
+            hm->body.p,
+            hm->body.len,
+            "{frame_delay: %d, leds_number: %d, frames_number: %d}",
+            &frame_delay,
+            &leds_number,
+            &frames_number);
+    if (hm->resp_code == 200 && frame_delay == up->frame_delay_ms && leds_number == up->leds &&
+        frames_number == up->frames) {
+        LOG(LL_INFO, ("%.*s - movie is already on the device, upload skipped", up->ip.len, up->ip.p));
+        up->progress.skipped = true;
+        up->progress.bytes_total = 0;
+        twinkly_device_request(device, METHOD_LED_MODE, "{\"mode\":\"movie\"}", movie_mode_cb, up);
+    } else {
+        twinkly_device_request(device, METHOD_LED_MODE, "{\"mode\":\"off\"}", movie_off_cb, up);
+    }
+}
+
+bool mgos_twinkly_movie_upload(
+        int idx,
+        const struct mgos_twinkly_movie* movie,
+        mgos_twinkly_movie_progress_cb_t progress_cb,
+        tw_cb_t cb,
+        void* arg) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev) {
+        LOG(LL_ERROR, ("Failed to get device %ld", (long) idx));
+        return false;
+    }
+    if (DEVICE_UNBOUND(dev)) {
+        LOG(LL_ERROR, ("%.*s - device has no address, waiting for re-resolution", dev->mac.len, dev->mac.p));
+        if (cb)
+            cb((void*) MGOS_TWINKLY_ERROR_UNBOUND, arg);
+        return true;
+    }
+    if (!movie || movie->frames <= 0 || (!movie->path == !movie->gen)) {
+        LOG(LL_ERROR, ("%.*s - invalid movie", dev->ip.len, dev->ip.p));
+        return false;
+    }
+    // Gen2 keeps movies in a playlist store with its own API
+    if (DEVICE_FAMILY(dev)->gen != 1) {
+        LOG(LL_ERROR, ("%.*s - movie upload is not supported by the family", dev->ip.len, dev->ip.p));
+        return false;
+    }
+    int leds = 0, bpl = 0;
+    mgos_twinkly_pixel_fn_t convert = NULL;
+    // Generator frames are converted from RGB, file frames are expected in the wire format already
+    if (!movie_led_config(dev, &leds, &bpl, &convert) || (movie->gen && !convert)) {
+        LOG(LL_ERROR, ("%.*s - unsupported led config %d x %d", dev->ip.len, dev->ip.p, leds, bpl));
+        return false;
+    }
+    struct twinkly_movie_upload* up = calloc(1, sizeof(struct twinkly_movie_upload));
+    if (!up)
+        return false;
+    up->leds = leds;
+    up->frame_size = leds * bpl;
+    up->frames = movie->frames;
+    up->frame_delay_ms = movie->frame_delay_ms > 0 ? movie->frame_delay_ms : MGOS_TWINKLY_MOVIE_FRAME_DELAY_MS;
+    up->convert = convert;
+    up->gen = movie->gen;
+    up->gen_arg = movie->gen_arg;
+    up->progress_cb = progress_cb;
+    up->cb = cb;
+    up->arg = arg;
+    up->progress.frames = movie->frames;
+    up->progress.bytes_total = up->frame_size * movie->frames;
+    up->frame = malloc(up->frame_size);
+    if (movie->gen)
+        up->rgb = malloc(leds * 3);
+    else
+        up->fp = fopen(movie->path, "rb");
+    up->device = twinkly_device_new(dev->ip);
+    up->ip = mg_strdup(dev->ip);
+    if (!up->frame || (movie->gen && !up->rgb) || (movie->path && !up->fp) || !up->device || !up->ip.p) {
+        LOG(LL_ERROR, ("%.*s - failed to start movie upload", dev->ip.len, dev->ip.p));
+        movie_upload_free(up);
+        return false;
+    }
+    if (movie->hash) {
+        up->hash = movie->hash;
+    } else if (!movie_hash(up, &up->hash)) {
+        LOG(LL_ERROR, ("%.*s - failed to read movie", dev->ip.len, dev->ip.p));
+        movie_upload_free(up);
+        return false;
+    }
+    LOG(LL_INFO,
+        ("%.*s - movie upload, %d frames x %lu bytes, hash %016llx",
+         dev->ip.len,
+         dev->ip.p,
+         up->frames,
+         (unsigned long) up->frame_size,
+         (unsigned long long) up->hash));
+    up->progress.started = mg_time();
+    char* stored = NULL;
+    json_scanf(dev->json.p, dev->json.len, "{_movie: %Q}", &stored);
+    bool cached = stored && strtoull(stored, NULL, 16) == up->hash;
+    free(stored);
+    if (cached)
+        twinkly_device_request(up->device, METHOD_LED_MODE_CONFIG, NULL, movie_cached_config_cb, up);
+    else
+        twinkly_device_request(up->device, METHOD_LED_MODE, "{\"mode\":\"off\"}", movie_off_cb, up);
+    return true;
+}
+
+// Fan-out: the movie is encoded once into a shared file, each target streams it with its own
+// descriptor and one frame buffer, so memory depends on the concurrency limit only
+struct movie_shared {
+    char* path;
+    bool temp; // encoded from generator, removed with the last reference
+    int refs;
+};
+
+struct movie_target {
+    struct twinkly_movie_fanout* fo;
+    struct mg_str ip;
+    int res;
+};
+
+struct twinkly_movie_fanout {
+    struct movie_target* targets;
+    int count;
+    int next;   // next target to start
+    int active; // uploads in progress
+    int concurrency;
+    bool launching; // uploads may fail synchronously while being started
+    struct movie_shared* shared;
+    struct mgos_twinkly_movie movie; // shared file based
+    struct mgos_twinkly_movie_fanout_result result;
+    double started;
+    mgos_twinkly_movie_progress_cb_t progress_cb;
+    tw_cb_t cb;
+    void* arg;
+};
+
+static struct movie_shared* movie_shared_ref(struct movie_shared* sh) {
+    sh->refs++;
+    return sh;
+}
+
+static void movie_shared_unref(struct movie_shared* sh) {
+    if (--sh->refs > 0)
+        return;
+    if (sh->temp)
+        remove(sh->path);
+    free(sh->path);
+    free(sh);
+}
+
+// Renders generator frames into the shared file in the wire format of the targets
+static struct movie_shared* movie_shared_encode(
+        const struct mgos_twinkly_movie* movie,
+        int leds,
+        size_t frame_size,
+        mgos_twinkly_pixel_fn_t convert) {
+    struct movie_shared* sh = calloc(1, sizeof(struct movie_shared));
+    if (!sh)
+        return NULL;
+    sh->refs = 1;
+    if (movie->path) {
+        sh->path = strdup(movie->path);
+        if (!sh->path) {
+            free(sh);
+            return NULL;
+        }
+        return sh;
+    }
+    static unsigned int s_tmp_seq = 0;
+    sh->temp = true;
+    mg_asprintf(&sh->path, 0, MOVIE_FANOUT_TMP_PATH, s_tmp_seq++);
+    uint8_t* rgb = malloc(leds * 3);
+    uint8_t* frame = malloc(frame_size);
+    FILE* fp = sh->path ? fopen(sh->path, "wb") : NULL;
+    bool ok = rgb && frame && fp;
+    for (int i = 0; ok && i < movie->frames; i++) {
+        ok = movie->gen(i, rgb, leds * 3, movie->gen_arg);
+        if (ok) {
+            convert(rgb, frame, leds);
+            ok = fwrite(frame, 1, frame_size, fp) == frame_size;
+        }
+    }
+    if (fp && fclose(fp) != 0)
+        ok = false;
+    free(rgb);
+    free(frame);
+    if (!ok) {
+        LOG(LL_ERROR, ("Failed to encode movie into %s", sh->path ? sh->path : "-"));
+        movie_shared_unref(sh);
+        return NULL;
+    }
+    return sh;
+}
+
+static void movie_fanout_next(struct twinkly_movie_fanout* fo);
+
+static void movie_fanout_finish(struct twinkly_movie_fanout* fo) {
+    fo->result.elapsed_s = mg_time() - fo->started;
+    LOG(LL_INFO,
+        ("Movie fan-out done, %d of %d devices in %.2f s",
+         fo->result.succeeded,
+         fo->result.targets,
+         fo->result.elapsed_s));
+    if (fo->cb)
+        fo->cb(&fo->result, fo->arg);
+    movie_shared_unref(fo->shared);
+    for (int i = 0; i < fo->count; i++)
+        mg_strfree(&fo->targets[i].ip);
+    free(fo->targets);
+    free(fo);
+}
+
+static void movie_fanout_progress_cb(
+        const struct mg_str* ip, const struct mgos_twinkly_movie_progress* progress, void* arg) {
+    struct movie_target* t = arg;
+    if (progress->done && progress->skipped)
+        t->fo->result.skipped++;
+    if (t->fo->progress_cb)
+        t->fo->progress_cb(ip, progress, t->fo->arg);
+}
+
+static void movie_fanout_done_cb(void* data, void* arg) {
+    struct movie_target* t = arg;
+    struct twinkly_movie_fanout* fo = t->fo;
+    t->res = (int) (intptr_t) data;
+    if (t->res == MGOS_TWINKLY_ERROR_OK)
+        fo->result.succeeded++;
+    else
+        fo->result.failed++;
+    fo->active--;
+    movie_shared_unref(fo->shared);
+    movie_fanout_next(fo);
+}
+
+static void movie_fanout_next(struct twinkly_movie_fanout* fo) {
+    if (fo->launching)
+        return;
+    fo->launching = true;
+    while (fo->active < fo->concurrency && fo->next < fo->count) {
+        struct movie_target* t = &fo->targets[fo->next++];
+        int idx = twinkly_registry_find(t->ip);
+        movie_shared_ref(fo->shared);
+        fo->active++;
+        if (!mgos_twinkly_movie_upload(idx, &fo->movie, movie_fanout_progress_cb, movie_fanout_done_cb, t)) {
+            fo->active--;
+            movie_shared_unref(fo->shared);
+            t->res = MGOS_TWINKLY_ERROR_RESPONSE;
+            fo->result.failed++;
+        }
+    }
+    fo->launching = false;
+    if (!fo->active && fo->next == fo->count)
+        movie_fanout_finish(fo);
+}
+
+bool mgos_twinkly_movie_upload_many(
+        const int* idx,
+        int count,
+        const struct mgos_twinkly_movie* movie,
+        int concurrency,
+        mgos_twinkly_movie_progress_cb_t progress_cb,
+        tw_cb_t cb,
+        void* arg) {
+    if (!idx || count <= 0 || !movie || movie->frames <= 0 || (!movie->path == !movie->gen))
+        return false;
+    // Targets have to share frame geometry, the movie is encoded once
+    int leds = 0, bpl = 0;
+    mgos_twinkly_pixel_fn_t convert = NULL;
+    for (int i = 0; i < count; i++) {
+        struct twinkly_device* dev = twinkly_registry_get(idx[i]);
+        int l = 0, b = 0;
+        mgos_twinkly_pixel_fn_t fn = NULL;
+        if (dev && DEVICE_UNBOUND(dev)) {
+            LOG(LL_ERROR, ("%.*s - device has no address, waiting for re-resolution", dev->mac.len, dev->mac.p));
+            return false;
+        }
+        if (!dev || !movie_led_config(dev, &l, &b, &fn) || (i && (l != leds || b != bpl || fn != convert))) {
+            LOG(LL_ERROR, ("Movie fan-out target %d does not match the first one", idx[i]));
+            return false;
+        }
+        leds = l;
+        bpl = b;
+        convert = fn;
+    }
+    if (movie->gen && !convert)
+        return false;
+    struct twinkly_movie_fanout* fo = calloc(1, sizeof(struct twinkly_movie_fanout));
+    struct movie_target* targets = calloc(count, sizeof(struct movie_target));
+    struct movie_shared* sh = (fo && targets) ? movie_shared_encode(movie, leds, leds * bpl, convert) : NULL;
+    if (!sh) {
+        free(fo);
+        free(targets);
+        return false;
+    }
+    for (int i = 0; i < count; i++) {
+        targets[i].fo = fo;
+        targets[i].ip = mg_strdup(twinkly_registry_get(idx[i])->ip);
+    }
+    fo->targets = targets;
+    fo->count = count;
+    fo->concurrency = concurrency > 0 ? concurrency : MGOS_TWINKLY_MOVIE_CONCURRENCY;
+    fo->shared = sh;
+    fo->movie = *movie;
+    fo->movie.path = sh->path;
+    fo->movie.gen = NULL;
+    fo->movie.gen_arg = NULL;
+    if (!fo->movie.hash) {
+        // Hashing the shared file once instead of per target
+        struct twinkly_movie_upload hu = {
+            .fp = fopen(sh->path, "rb"),
+            .frame = malloc(leds * bpl),
+            .frame_size = leds * bpl,
+            .frames = movie->frames,
+            .frame_delay_ms = movie->frame_delay_ms > 0 ? movie->frame_delay_ms : MGOS_TWINKLY_MOVIE_FRAME_DELAY_MS,
+        };
+        if (!hu.fp || !hu.frame || !movie_hash(&hu, &fo->movie.hash))
+            fo->movie.hash = 0;
+        if (hu.fp)
+            fclose(hu.fp);
+        free(hu.frame);
+    }
+    fo->result.targets = count;
+    fo->started = mg_time();
+    fo->progress_cb = progress_cb;
+    fo->cb = cb;
+    fo->arg = arg;
+    LOG(LL_INFO, ("Movie fan-out to %d devices, %d at a time", count, fo->concurrency));
+    movie_fanout_next(fo);
+    return true;
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright 2020 d4rkmen <darkmen@i.ua>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mgos.h"
+#include "mgos_twinkly.h"
+
+// Conversion kernels from canonical RGB (3 bytes per LED) to the device wire format.
+// Loops are kept branch free over restrict pointers, so the compiler can vectorize them.
+
+#define MIN3(a, b, c) ((a) < (b) ? ((a) < (c) ? (a) : (c)) : ((b) < (c) ? (b) : (c)))
+
+// RGB: R G B
+static void pixel_rgb(const uint8_t* restrict src, uint8_t* restrict dst, size_t n) {
+    memcpy(dst, src, n * 3);
+}
+
+// RGBW: W R G B, white is extracted from the common part of the channels
+static void pixel_rgbw(const uint8_t* restrict src, uint8_t* restrict dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        uint8_t r = src[i * 3 + 0], g = src[i * 3 + 1], b = src[i * 3 + 2];
+        uint8_t w = MIN3(r, g, b);
+        dst[i * 4 + 0] = w;
+        dst[i * 4 + 1] = r - w;
+        dst[i * 4 + 2] = g - w;
+        dst[i * 4 + 3] = b - w;
+    }
+}
+
+// AWW: bytes are amber, warm white, cool white. Cool white is min(r, g, b), warm white is the
+// yellow part of the remainder, min(r, g) - cw, amber is the red left over. Blue and green
+// beyond these parts have no emitter and are dropped.
+static void pixel_aww(const uint8_t* restrict src, uint8_t* restrict dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        uint8_t r = src[i * 3 + 0], g = src[i * 3 + 1], b = src[i * 3 + 2];
+        uint8_t cw = MIN3(r, g, b);
+        uint8_t r1 = r - cw, g1 = g - cw;
+        uint8_t ww = r1 < g1 ? r1 : g1;
+        dst[i * 3 + 0] = r1 - ww;
+        dst[i * 3 + 1] = ww;
+        dst[i * 3 + 2] = cw;
+    }
+}
+
+// RBW: bytes are red, blue, white, assuming the device wire order follows the profile name.
+// White is min(r, g, b), green above it has no emitter and is dropped.
+static void pixel_rbw(const uint8_t* restrict src, uint8_t* restrict dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        uint8_t r = src[i * 3 + 0], g = src[i * 3 + 1], b = src[i * 3 + 2];
+        uint8_t w = MIN3(r, g, b);
+        dst[i * 3 + 0] = r - w;
+        dst[i * 3 + 1] = b - w;
+        dst[i * 3 + 2] = w;
+    }
+}
+
+static const struct {
+    const char* profile;
+    int bpl;
+    mgos_twinkly_pixel_fn_t fn;
+} s_pixel_formats[] = {
+    { "RGB", 3, pixel_rgb },
+    { "RGBW", 4, pixel_rgbw },
+    { "AWW", 3, pixel_aww },
+    { "RBW", 3, pixel_rbw },
+};
+
+mgos_twinkly_pixel_fn_t mgos_twinkly_pixel_get_fn(const char* led_profile, int* bpl) {
+    for (int i = 0; led_profile && i < sizeof(s_pixel_formats) / sizeof(s_pixel_formats[0]); i++)
+        if (strcmp(led_profile, s_pixel_formats[i].profile) == 0) {
+            if (bpl)
+                *bpl = s_pixel_formats[i].bpl;
+            return s_pixel_formats[i].fn;
+        }
+    return NULL;
+}
+
+void mgos_twinkly_pixel_from_float(const float* src, uint8_t* dst, size_t n) {
+    const float* restrict s = src;
+    uint8_t* restrict d = dst;
+    for (size_t i = 0; i < n * 3; i++) {
+        float v = s[i] * 255.0f + 0.5f;
+        v = v < 0.0f ? 0.0f : v;
+        v = v > 255.0f ? 255.0f : v;
+        d[i] = (uint8_t) v;
+    }
+}
+
+// White point gains for color temperature, Tanner Helland blackbody approximation, 6600K is neutral
+static void lut_white_point(int kelvin, float* r, float* g, float* b) {
+    float t = (kelvin < 1000 ? 1000 : kelvin > 40000 ? 40000 : kelvin) / 100.0f;
+    float vr, vg, vb;
+    if (t <= 66.0f) {
+        vr = 255.0f;
+        vg = 99.4708025861f * logf(t) - 161.1195681661f;
+        vb = t <= 19.0f ? 0.0f : 138.5177312231f * logf(t - 10.0f) - 305.0447927307f;
+    } else {
+        vr = 329.698727446f * powf(t - 60.0f, -0.1332047592f);
+        vg = 288.1221695283f * powf(t - 60.0f, -0.0755148492f);
+        vb = 255.0f;
+    }
+    *r = (vr < 0.0f ? 0.0f : vr > 255.0f ? 255.0f : vr) / 255.0f;
+    *g = (vg < 0.0f ? 0.0f : vg > 255.0f ? 255.0f : vg) / 255.0f;
+    *b = (vb < 0.0f ? 0.0f : vb > 255.0f ? 255.0f : vb) / 255.0f;
+}
+
+void mgos_twinkly_lut_build(struct mgos_twinkly_lut* lut, float gamma, int brightness, int kelvin) {
+    float gr = 1.0f, gg = 1.0f, gb = 1.0f;
+    if (kelvin > 0)
+        lut_white_point(kelvin, &gr, &gg, &gb);
+    if (gamma <= 0.0f)
+        gamma = 1.0f;
+    float scale = (brightness < 0 ? 0 : brightness > 100 ? 100 : brightness) / 100.0f * 255.0f;
+    for (int i = 0; i < 256; i++) {
+        float v = powf(i / 255.0f, gamma) * scale;
+        lut->r[i] = (uint8_t)(v * gr + 0.5f);
+        lut->g[i] = (uint8_t)(v * gg + 0.5f);
+        lut->b[i] = (uint8_t)(v * gb + 0.5f);
+    }
+    lut->gamma = gamma;
+    lut->brightness = brightness;
+    lut->kelvin = kelvin;
+}
+
+void mgos_twinkly_lut_apply(const struct mgos_twinkly_lut* lut, const uint8_t* src, uint8_t* dst, size_t leds) {
+    for (size_t i = 0; i < leds; i++) {
+        uint8_t r = src[i * 3 + 0], g = src[i * 3 + 1], b = src[i * 3 + 2];
+        dst[i * 3 + 0] = lut->r[r];
+        dst[i * 3 + 1] = lut->g[g];
+        dst[i * 3 + 2] = lut->b[b];
+    }
+}
@@ -1,3284 +1,3402 @@
 #include "mgos_twinkly.h"
 
-static const struct mgos_twinkly_product twinkly_products[] = {
-    { .product_code = "TW100",
-      .commercial_name = "Twinkly Strings (2016)",
-      .firmware_family = "A",
-      .led_profile = "RGB",
-      .led_number = 100,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW2016",
-      .commercial_name = "Twinkly Strings (2016)",
-      .firmware_family = "A",
-      .led_profile = "RGB",
-      .led_number = 100,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "LL224C01M01",
-      .commercial_name = "LeaveUp Lights",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 224,
-      .default_name = "Custom",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
-      .mapping_allowed = true },
-    { .product_code = "MP056SEUM05",
-      .commercial_name = "Mini Pixel 56",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "MP224SEUM06",
-      .commercial_name = "Mini Pixel 224",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 224,
-      .default_name = "Custom",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
-      .mapping_allowed = true },
-    { .product_code = "MP224XUSM07",
-      .commercial_name = "Mini Pixel 224",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 224,
-      .default_name = "Custom",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
-      .mapping_allowed = true },
-    { .product_code = "TW056SEUM04",
-      .commercial_name = "Twinkly Strings 56",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW056SEUM05",
-      .commercial_name = "Twinkly Strings 56",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW056SEUM06",
-      .commercial_name = "Twinkly Strings 56",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW056SEUM07",
-      .commercial_name = "Twinkly Strings 56",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW105SEUM04",
-      .commercial_name = "Twinkly Strings 105",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 105,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW105SEUM06",
-      .commercial_name = "Twinkly Strings 105",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 105,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW105SEUM07",
-      .commercial_name = "Twinkly Strings 105",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 105,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW175SEUM04",
-      .commercial_name = "Twinkly Strings 175",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW175SEUM06",
-      .commercial_name = "Twinkly Strings 175",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW175SEUM07",
-      .commercial_name = "Twinkly Strings 175",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW224SEUM04",
-      .commercial_name = "Twinkly (2017)",
-      .firmware_family = "B",
-      .led_profile = "RGB",
-      .led_number = 224,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "CUS245STQ08",
-      .firmware_family = "C",
-      .led_profile = "RGB",
-      .led_number = 245,
-      .default_name = "CustomStar",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "CUS497HHQ08",
-      .firmware_family = "C",
-      .led_profile = "RGB",
-      .led_number = 494,
-      .default_name = "CustomHH",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "CUS553MCQ08",
-      .firmware_family = "C",
-      .led_profile = "RGB",
-      .led_number = 547,
-      .default_name = "CustomMC",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "FR525C01P",
-      .commercial_name = "Interactive Tree",
-      .firmware_family = "C",
-      .led_profile = "RGB",
-      .led_number = 525,
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true },
-    { .product_code = "PT597C01P",
-      .commercial_name = "Twinkly PreLit Tree 597",
-      .firmware_family = "C",
-      .led_profile = "RGB",
-      .led_number = 597,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TP255TEUP06",
-      .commercial_name = "Twinkly PreLit Tree 225",
-      .firmware_family = "C",
-      .led_profile = "RGB",
-      .led_number = 225,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TP270TEUP07",
-      .commercial_name = "Twinkly PreLit Tree 270",
-      .firmware_family = "C",
-      .led_profile = "RGB",
-      .led_number = 270,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TP330TEUP07",
-      .commercial_name = "Twinkly PreLit Tree 330",
-      .firmware_family = "C",
-      .led_profile = "RGB",
-      .led_number = 330,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "pre_lit_tree" },
+// Deduplicated pool of the catalog strings, packed entries keep 1 byte index into it
+#define TWINKLY_STRINGS(X) \
+    X(TWS_NONE, NULL) \
+    X(TWS_A, "A") \
+    X(TWS_B, "B") \
+    X(TWS_C, "C") \
+    X(TWS_D, "D") \
+    X(TWS_E, "E") \
+    X(TWS_F, "F") \
+    X(TWS_G, "G") \
+    X(TWS_H, "H") \
+    X(TWS_J, "J") \
+    X(TWS_K, "K") \
+    X(TWS_L, "L") \
+    X(TWS_M, "M") \
+    X(TWS_N, "N") \
+    X(TWS_P, "P") \
+    X(TWS_TM, "TM") \
+    X(TWS_AWW, "AWW") \
+    X(TWS_RBW, "RBW") \
+    X(TWS_RGB, "RGB") \
+    X(TWS_RGBW, "RGBW") \
+    X(TWS_Ball, "Ball") \
+    X(TWS_Candy_Cane, "Candy Cane") \
+    X(TWS_Cluster, "Cluster") \
+    X(TWS_Cone, "Cone") \
+    X(TWS_Curtain, "Curtain") \
+    X(TWS_Custom, "Custom") \
+    X(TWS_CustomHH, "CustomHH") \
+    X(TWS_CustomMC, "CustomMC") \
+    X(TWS_CustomStar, "CustomStar") \
+    X(TWS_Deer, "Deer") \
+    X(TWS_Festoon, "Festoon") \
+    X(TWS_Garland, "Garland") \
+    X(TWS_Icicle, "Icicle") \
+    X(TWS_Led_Strip, "Led Strip") \
+    X(TWS_Lollipop, "Lollipop") \
+    X(TWS_Net, "Net") \
+    X(TWS_One_String, "One String") \
+    X(TWS_Snowflake, "Snowflake") \
+    X(TWS_Snowman, "Snowman") \
+    X(TWS_Spritzer, "Spritzer") \
+    X(TWS_Strings, "Strings") \
+    X(TWS_Topper, "Topper") \
+    X(TWS_Tree, "Tree") \
+    X(TWS_TwinklyMusic, "TwinklyMusic") \
+    X(TWS_Wall, "Wall") \
+    X(TWS_Wreath, "Wreath") \
+    X(TWS_2D, "2D") \
+    X(TWS_Linear, "Linear") \
+    X(TWS_Matrix, "Matrix") \
+    X(TWS_Single, "Single") \
+    X(TWS_Vertical, "Vertical") \
+    X(TWS_c12, "c12") \
+    X(TWS_c7, "c7") \
+    X(TWS_c9, "c9") \
+    X(TWS_candycane, "candycane") \
+    X(TWS_dor, "dor") \
+    X(TWS_dot, "dot") \
+    X(TWS_g35, "g35") \
+    X(TWS_gsnowflake, "gsnowflake") \
+    X(TWS_icicle, "icicle") \
+    X(TWS_lollipop, "lollipop") \
+    X(TWS_snowflake, "snowflake") \
+    X(TWS_topper, "topper") \
+    X(TWS_CandyCane, "CandyCane") \
+    X(TWS_IcicleLed, "IcicleLed") \
+    X(TWS_LightStrip, "LightStrip") \
+    X(TWS_Strings_AWW, "Strings-AWW") \
+    X(TWS_Strings_RGBW, "Strings-RGBW") \
+    X(TWS_Strings_RWB, "Strings-RWB") \
+    X(TWS_Strip, "Strip") \
+    X(TWS_ConeTree, "ConeTree") \
+    X(TWS_Pathway, "Pathway") \
+    X(TWS_cluster, "cluster") \
+    X(TWS_cone, "cone") \
+    X(TWS_garland, "garland") \
+    X(TWS_pre_lit_tree, "pre_lit_tree") \
+    X(TWS_reindeer, "reindeer") \
+    X(TWS_snowman, "snowman") \
+    X(TWS_spritzer, "spritzer") \
+    X(TWS_string, "string") \
+    X(TWS_strip, "strip") \
+    X(TWS_wall, "wall") \
+    X(TWS_wreath, "wreath")
+
+enum twinkly_str {
+#define X(id, str) id,
+    TWINKLY_STRINGS(X)
+#undef X
+};
+
+static const char* const twinkly_strings[] = {
+#define X(id, str) str,
+    TWINKLY_STRINGS(X)
+#undef X
+};
+
+// Packed catalog entry, mgos_twinkly_get_product() unpacks it into struct mgos_twinkly_product
+struct twinkly_product_packed {
+    const char* product_code;
+    const char* commercial_name;
+    uint16_t led_number;
+    uint8_t firmware_family; // enum twinkly_str
+    uint8_t device_family;   // enum twinkly_str
+    uint8_t led_profile;     // enum twinkly_str
+    uint8_t default_name;    // enum twinkly_str
+    uint8_t layout_type;     // enum twinkly_str
+    uint8_t pixel_shape;     // enum twinkly_str
+    uint8_t join_fml;        // enum twinkly_str
+    uint8_t sync_fml;        // enum twinkly_str
+    uint8_t icon;            // enum twinkly_str
+    uint8_t mapping_allowed : 1;
+    uint8_t bluetooth : 1;
+    uint8_t microphone : 1;
+};
+
+// Keep sorted by product_code (strcmp order), mgos_twinkly_get_product() does binary search
+static const struct twinkly_product_packed twinkly_products[] = {
     { .product_code = "CC015C14P",
       .commercial_name = "Polygroup Pathway Light CandyCane 15L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 15,
-      .default_name = "Candy Cane",
-      .layout_type = "2D",
-      .pixel_shape = "candycane",
+      .default_name = TWS_Candy_Cane,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_candycane,
       .mapping_allowed = false,
-      .join_fml = "CandyCane",
-      .sync_fml = "Pathway",
+      .join_fml = TWS_CandyCane,
+      .sync_fml = TWS_Pathway,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "CC015C14P5E",
       .commercial_name = "Polygroup Pathway Light CandyCane 15L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 15,
-      .default_name = "Candy Cane",
-      .layout_type = "2D",
-      .pixel_shape = "candycane",
+      .default_name = TWS_Candy_Cane,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_candycane,
       .mapping_allowed = false,
-      .join_fml = "CandyCane",
-      .sync_fml = "Pathway",
+      .join_fml = TWS_CandyCane,
+      .sync_fml = TWS_Pathway,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "CC015C20P",
       .commercial_name = "Polygroup Pathway Light CandyCane 15L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 15,
-      .default_name = "Candy Cane",
-      .layout_type = "2D",
-      .pixel_shape = "candycane",
+      .default_name = TWS_Candy_Cane,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_candycane,
       .mapping_allowed = false,
-      .join_fml = "CandyCane",
-      .sync_fml = "Pathway",
+      .join_fml = TWS_CandyCane,
+      .sync_fml = TWS_Pathway,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "CT090C01PTS",
       .commercial_name = "Polygroup Cone Tree 90L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 90,
-      .default_name = "Cone",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Cone,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "ConeTree",
+      .sync_fml = TWS_ConeTree,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "CT090C20PTS",
       .commercial_name = "Polygroup Cone Tree 90L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 90,
-      .default_name = "Cone",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Cone,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "ConeTree",
+      .sync_fml = TWS_ConeTree,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "CT110C01PTS",
       .commercial_name = "Polygroup Cone Tree 110L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 110,
-      .default_name = "Cone",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Cone,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "ConeTree",
+      .sync_fml = TWS_ConeTree,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "CT110C20PTS",
       .commercial_name = "Polygroup Cone Tree 110L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 110,
-      .default_name = "Cone",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Cone,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "ConeTree",
+      .sync_fml = TWS_ConeTree,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "CT130C01PTS",
       .commercial_name = "Polygroup Cone Tree 130L (discontinued)",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 130,
-      .default_name = "Cone",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Cone,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "ConeTree",
+      .sync_fml = TWS_ConeTree,
       .bluetooth = false,
       .microphone = false },
+    { .product_code = "CUS245STQ08",
+      .firmware_family = TWS_C,
+      .led_profile = TWS_RGB,
+      .led_number = 245,
+      .default_name = TWS_CustomStar,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "CUS497HHQ08",
+      .firmware_family = TWS_C,
+      .led_profile = TWS_RGB,
+      .led_number = 494,
+      .default_name = TWS_CustomHH,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "CUS553MCQ08",
+      .firmware_family = TWS_C,
+      .led_profile = TWS_RGB,
+      .led_number = 547,
+      .default_name = TWS_CustomMC,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "FR525C01P",
+      .commercial_name = "Interactive Tree",
+      .firmware_family = TWS_C,
+      .led_profile = TWS_RGB,
+      .led_number = 525,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true },
     { .product_code = "GV100C01P",
       .commercial_name = "Golden Vessel clones",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 100,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "IC005C20PIC",
       .commercial_name = "Polygroup Icicle Style 5L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 5,
-      .default_name = "Icicle",
-      .layout_type = "Linear",
-      .pixel_shape = "icicle",
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_icicle,
       .mapping_allowed = true,
-      .join_fml = "IcicleLed",
-      .sync_fml = "IcicleLed",
+      .join_fml = TWS_IcicleLed,
+      .sync_fml = TWS_IcicleLed,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "IC010C20PIC",
       .commercial_name = "Polygroup Icicle Style 10L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 10,
-      .default_name = "Icicle",
-      .layout_type = "Linear",
-      .pixel_shape = "icicle",
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_icicle,
       .mapping_allowed = true,
-      .join_fml = "IcicleLed",
-      .sync_fml = "IcicleLed",
+      .join_fml = TWS_IcicleLed,
+      .sync_fml = TWS_IcicleLed,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "IC050C06PWD",
       .commercial_name = "Polygroup Icycle 50L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 50,
-      .default_name = "Icicle",
-      .layout_type = "Icicle",
-      .pixel_shape = "dot",
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Icicle,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Icicle",
-      .sync_fml = "Icicle",
+      .join_fml = TWS_Icicle,
+      .sync_fml = TWS_Icicle,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "IC050C09PWD",
       .commercial_name = "Polygroup Icycle 50L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 50,
-      .default_name = "Icicle",
-      .layout_type = "Icicle",
-      .pixel_shape = "dot",
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Icicle,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Icicle",
-      .sync_fml = "Icicle",
+      .join_fml = TWS_Icicle,
+      .sync_fml = TWS_Icicle,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "IC050C20PWD",
       .commercial_name = "Polygroup Icycle 50L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 50,
-      .default_name = "Icicle",
-      .layout_type = "Icicle",
-      .pixel_shape = "dot",
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Icicle,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Icicle",
-      .sync_fml = "Icicle",
+      .join_fml = TWS_Icicle,
+      .sync_fml = TWS_Icicle,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "LL030C07P10E",
       .commercial_name = "Polygroup Pathway Light Lollipop 50L (discontinued)",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 30,
-      .default_name = "Lollipop",
-      .layout_type = "2D",
-      .pixel_shape = "lollipop",
+      .default_name = TWS_Lollipop,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_lollipop,
       .mapping_allowed = false,
-      .join_fml = "Lollipop",
-      .sync_fml = "Pathway",
+      .join_fml = TWS_Lollipop,
+      .sync_fml = TWS_Pathway,
       .bluetooth = false,
       .microphone = false },
+    { .product_code = "LL224C01M01",
+      .commercial_name = "LeaveUp Lights",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
+      .led_number = 224,
+      .default_name = TWS_Custom,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true },
     { .product_code = "LP001C01P15E",
       .commercial_name = "Polygroup LED Ball",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 1,
-      .default_name = "Ball",
-      .layout_type = "Single",
-      .pixel_shape = "dot",
+      .default_name = TWS_Ball,
+      .layout_type = TWS_Single,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = false,
-      .join_fml = "Ball",
-      .sync_fml = "Ball",
+      .join_fml = TWS_Ball,
+      .sync_fml = TWS_Ball,
       .bluetooth = false,
       .microphone = false },
+    { .product_code = "LS060C09PRP",
+      .commercial_name = "Polygroup Led Strip 60L",
+      .firmware_family = TWS_J,
+      .led_profile = TWS_RGB,
+      .led_number = 60,
+      .default_name = TWS_Led_Strip,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strip,
+      .sync_fml = TWS_Strip,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_strip },
     { .product_code = "LS100C08PRP",
       .commercial_name = "Polygroup Led Strip 100L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 100,
+      .default_name = TWS_Led_Strip,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_LightStrip,
+      .sync_fml = TWS_LightStrip,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_strip },
+    { .product_code = "LS100C09PRP",
+      .commercial_name = "Polygroup Led Strip 100L",
+      .firmware_family = TWS_J,
+      .led_profile = TWS_RGB,
+      .led_number = 100,
+      .default_name = TWS_Led_Strip,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strip,
+      .sync_fml = TWS_Strip,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_strip },
+    { .product_code = "LS100C20PRP",
+      .commercial_name = "Polygroup Led Strip 100L",
+      .firmware_family = TWS_J,
+      .led_profile = TWS_RGB,
       .led_number = 100,
-      .default_name = "Led Strip",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Led_Strip,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "LightStrip",
-      .sync_fml = "LightStrip",
+      .join_fml = TWS_Strip,
+      .sync_fml = TWS_Strip,
       .bluetooth = false,
       .microphone = false,
-      .icon = "strip" },
+      .icon = TWS_strip },
     { .product_code = "LS100S01P07",
       .commercial_name = "String 100",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 100,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "LS100S02P07",
       .commercial_name = "String 100",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 100,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "LS175S01P07",
       .commercial_name = "String 175",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "LS225S01P07",
       .commercial_name = "Strings 225",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 225,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
+    { .product_code = "MF150BRTHD",
+      .commercial_name = "Twinkly MF Edition",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 150,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_RGBW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
     { .product_code = "ML050C09P",
       .commercial_name = "Polygroup Led Lights RGB 50L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 50,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML050C20P",
       .commercial_name = "Polygroup Led Lights RGB 50L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 50,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML056C08P",
       .commercial_name = "Polygroup Led Lights RGB 56L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML056C09P",
       .commercial_name = "Polygroup Led Lights RGB 56L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML056C20P",
       .commercial_name = "Polygroup Led Lights RGB 56L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML100C09P",
       .commercial_name = "Polygroup Led Lights RGB 100L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 100,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML100C20P",
       .commercial_name = "Polygroup Led Lights RGB 100L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 100,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML105C08P",
       .commercial_name = "Polygroup Led Lights RGB 105L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 105,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML105C09P",
       .commercial_name = "Polygroup Led Lights RGB 105L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 105,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML105C20P",
       .commercial_name = "Polygroup Led Lights RGB 105L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 105,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML150C08P",
       .commercial_name = "Polygroup Led Lights RGB 150L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 150,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML150C09P",
       .commercial_name = "Polygroup Led Lights RGB 150L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 150,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML150C20P",
       .commercial_name = "Polygroup Led Lights RGB 150L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 150,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML175C08P",
       .commercial_name = "Polygroup Led Lights RGB 175L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "ML175C20P",
       .commercial_name = "Polygroup Led Lights RGB 175L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "MN800EUP00",
+      .commercial_name = "Minleon Lora - UNICORN - Twinkly",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 800,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "MN800EUS00",
+      .commercial_name = "Minleon Lora - UNICORN - SPI",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGB,
+      .led_number = 800,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "MP056SEUM05",
+      .commercial_name = "Mini Pixel 56",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
+      .led_number = 56,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
+    { .product_code = "MP224SEUM06",
+      .commercial_name = "Mini Pixel 224",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
+      .led_number = 224,
+      .default_name = TWS_Custom,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true },
+    { .product_code = "MP224XUSM07",
+      .commercial_name = "Mini Pixel 224",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
+      .led_number = 224,
+      .default_name = TWS_Custom,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true },
     { .product_code = "NE080C20PMD",
       .commercial_name = "Polygroup Net Light 80L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 80,
-      .default_name = "Net",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .default_name = TWS_Net,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "NE100C02PMD",
       .commercial_name = "Polygroup Net Light 100L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 100,
-      .default_name = "Net",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .default_name = TWS_Net,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "NE100C20PMD",
       .commercial_name = "Polygroup Net Light 100L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 100,
-      .default_name = "Net",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .default_name = TWS_Net,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "NE80C20PMD",
       .commercial_name = "Polygroup Net Light 80L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 80,
-      .default_name = "Net",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .default_name = TWS_Net,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "OS008C10P",
       .commercial_name = "Polygroup Legacy",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 8,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "dor",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dor,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS012C06P",
       .commercial_name = "Polygroup Legacy",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 12,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "dor",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dor,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS020C20P",
       .commercial_name = "Polygroup One String Light 20L C7 C9 C12 G35",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 20,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "c9",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_c9,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS020C20PC12",
       .commercial_name = "Polygroup One String Light 20L C12",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 20,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "c12",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_c12,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS020C20PC7",
       .commercial_name = "Polygroup One String Light 20L C7",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 20,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "c7",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_c7,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS020C20PC9",
       .commercial_name = "Polygroup One String Light 20L C9",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 20,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "c9",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_c9,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS020C20PG35",
       .commercial_name = "Polygroup One String Light 20L G35",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 20,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "g35",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_g35,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS024C05P",
       .commercial_name = "Polygroup Legacy",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 24,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "dor",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dor,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS025C08P",
       .commercial_name = "Polygroup One String Light 25L C7 C9 C12 G35",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 25,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "c7",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_c7,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS025C08PC12",
       .commercial_name = "Polygroup One String Light 25L C12",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 25,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "c12",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_c12,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS025C08PC9",
       .commercial_name = "Polygroup One String Light 25L C9",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 25,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "c9",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_c9,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS025C08PG35",
       .commercial_name = "Polygroup One String Light 25L G35",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 25,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "g35",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_g35,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS025C20P",
       .commercial_name = "Polygroup One String Light 25L C7 C9 C12 G35",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 25,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "c7",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_c7,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS025C20PC12",
       .commercial_name = "Polygroup One String Light 25L C12",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 25,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "c12",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_c12,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS025C20PC7",
       .commercial_name = "Polygroup One String Light 25L C7",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 25,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "c7",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_c7,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS025C20PG35",
       .commercial_name = "Polygroup One String Light 25L G35",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 25,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "g35",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_g35,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS040C20PGS",
       .commercial_name = "Polygroup Garland 40L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 40,
-      .default_name = "Garland",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Garland,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS048C05P",
       .commercial_name = "Polygroup Legacy",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 48,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "dor",
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dor,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS050C04PGS",
       .commercial_name = "Polygroup Garland 50L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 50,
-      .default_name = "Garland",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Garland,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS050C09PGS",
       .commercial_name = "Polygroup Garland 50L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 50,
-      .default_name = "Garland",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Garland,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "OS050C20PGS",
       .commercial_name = "Polygroup Garland 50L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 50,
-      .default_name = "Garland",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Garland,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "SF030C20P",
-      .commercial_name = "Polygroup Pathway Light Snowflake 30L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 30,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "snowflake",
-      .mapping_allowed = false,
-      .sync_fml = "Pathway",
-      .bluetooth = false,
-      .microphone = false },
-    { .product_code = "SF030C20P10E",
-      .commercial_name = "Polygroup Pathway Light Snowflake 30L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 30,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "snowflake",
-      .mapping_allowed = false,
-      .sync_fml = "Pathway",
-      .bluetooth = false,
-      .microphone = false },
-    { .product_code = "SF045C04P",
-      .commercial_name = "Polygroup Pathway Light Snowflake 45L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 45,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "snowflake",
-      .mapping_allowed = false,
-      .sync_fml = "Pathway",
-      .bluetooth = false,
-      .microphone = false },
-    { .product_code = "SF045C04P15E",
-      .commercial_name = "Polygroup Pathway Light Snowflake 45L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 45,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "snowflake",
-      .mapping_allowed = false,
-      .sync_fml = "Pathway",
-      .bluetooth = false,
-      .microphone = false },
-    { .product_code = "SF045C20P",
-      .commercial_name = "Polygroup Pathway Light Snowflake 45L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 45,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "snowflake",
+      .icon = TWS_string },
+    { .product_code = "PCPM015STP",
+      .commercial_name = "Polygroup Candy Cane Pathway Markers G2",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 15,
+      .default_name = TWS_Candy_Cane,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_candycane,
       .mapping_allowed = false,
-      .sync_fml = "Pathway",
+      .join_fml = TWS_CandyCane,
+      .sync_fml = TWS_Pathway,
       .bluetooth = false,
       .microphone = false },
-    { .product_code = "SF045C20P15E",
-      .commercial_name = "Polygroup Pathway Light Snowflake 45L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 45,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "snowflake",
-      .mapping_allowed = false,
-      .sync_fml = "Pathway",
+    { .product_code = "PCT090STP",
+      .commercial_name = "Polygroup Cone Tree G2",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 90,
+      .default_name = TWS_Cone,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .sync_fml = TWS_ConeTree,
       .bluetooth = false,
       .microphone = false },
-    { .product_code = "SF060C011H",
+    { .product_code = "PGI050GOP",
+      .commercial_name = "Polygroup Icicle G2 AWW 50L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 50,
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Icicle,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Icicle,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_wall },
+    { .product_code = "PGI190GOP",
+      .commercial_name = "Polygroup Icicle G2 AWW 190L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 190,
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Icicle,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Icicle,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_wall },
+    { .product_code = "PGI190STP",
+      .commercial_name = "Polygroup Icicle G2 RGB 190L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 190,
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Icicle,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Icicle,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_wall },
+    { .product_code = "PGS050GOP",
+      .commercial_name = "Polygroup Led Lights G2 AWW 50L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 50,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_AWW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS050SPP",
+      .commercial_name = "Polygroup Led Lights G2 RGBW 50L",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 50,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_RGBW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS050STP",
+      .commercial_name = "Polygroup Led Lights G2 RGB 50L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 50,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS056GOP",
+      .commercial_name = "Polygroup Led Lights G2 AWW 56L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 56,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_AWW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS060STP",
+      .commercial_name = "Polygroup Giant Snowflake G2",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 60,
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_gsnowflake,
+      .mapping_allowed = false,
+      .sync_fml = TWS_Snowflake,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "PGS100GOP",
+      .commercial_name = "Polygroup Led Lights G2 AWW 100L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 100,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_AWW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS100SPP",
+      .commercial_name = "Polygroup Led Lights G2 RGBW 100L",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 100,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_RGBW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS100STP",
+      .commercial_name = "Polygroup Led Lights G2 RGB 100L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 100,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS105GOP",
+      .commercial_name = "Polygroup Led Lights G2 AWW 105L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 105,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_AWW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS150GOP",
+      .commercial_name = "Polygroup Led Lights G2 AWW 150L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 150,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_AWW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS150SPP",
+      .commercial_name = "Polygroup Led Lights G2 RGBW 150L",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 150,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_RGBW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS150STP",
+      .commercial_name = "Polygroup Led Lights G2 RGB 150L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 150,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS250GOP",
+      .commercial_name = "Polygroup Led Lights G2 AWW 250L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 250,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_AWW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS250SPP",
+      .commercial_name = "Polygroup Led Lights G2 RGBW 250L",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 250,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_RGBW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS250STP",
+      .commercial_name = "Polygroup Led Lights G2 RGB 250L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 250,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS400GOP",
+      .commercial_name = "Polygroup Led Lights G2 AWW 400L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 400,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_AWW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS400SPP",
+      .commercial_name = "Polygroup Led Lights G2 RGBW 400L",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 400,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings_RGBW,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS400STP",
+      .commercial_name = "Polygroup Led Lights G2 RGB 400L",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 400,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGS600STP",
+      .commercial_name = "Polygroup Led Lights G2 RGB 600L",
+      .firmware_family = TWS_M,
+      .led_profile = TWS_RGB,
+      .led_number = 600,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "PGT750SPP",
+      .commercial_name = "Polygroup PreLit Tree 2020 - GEN II RGBW",
+      .firmware_family = TWS_N,
+      .led_profile = TWS_RGBW,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .sync_fml = TWS_Tree,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "PGT750STP",
+      .commercial_name = "Polygroup PreLit Tree 2020 - GEN II",
+      .firmware_family = TWS_L,
+      .led_profile = TWS_RGB,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .sync_fml = TWS_Tree,
+      .bluetooth = true,
+      .microphone = false,
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "PIC050STP",
+      .commercial_name = "Polygroup Icicle Style LED Wrapped Dome G2",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 50,
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Icicle,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Icicle,
+      .sync_fml = TWS_Icicle,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_wall },
+    { .product_code = "PLI005STP",
+      .commercial_name = "Polygroup Large Icicle LED lights G2",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 5,
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_Icicle,
+      .mapping_allowed = true,
+      .join_fml = TWS_IcicleLed,
+      .sync_fml = TWS_IcicleLed,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "PLT300STP-G" },
+    { .product_code = "PLT400STP-G" },
+    { .product_code = "PLT490STP-G" },
+    { .product_code = "PLT495STP-G" },
+    { .product_code = "PNE080STP",
+      .commercial_name = "Polygroup Net Style LED Mini Dome G2",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 80,
+      .default_name = TWS_Net,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_wall },
+    { .product_code = "POS020STP",
+      .commercial_name = "Polygroup One String C7 / C9 / C12 / G35 G2",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 20,
+      .default_name = TWS_One_String,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_c7,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "POS040STP",
+      .commercial_name = "Polygroup Garland Style LED lights G2",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 40,
+      .default_name = TWS_Garland,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "PSPM030STP",
+      .commercial_name = "Polygroup Snowflake Pathway Markers G2",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 30,
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_snowflake,
+      .mapping_allowed = false,
+      .sync_fml = TWS_Pathway,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "PT597C01P",
+      .commercial_name = "Twinkly PreLit Tree 597",
+      .firmware_family = TWS_C,
+      .led_profile = TWS_RGB,
+      .led_number = 597,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .sync_fml = TWS_Tree,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "PT600W00P08",
+      .commercial_name = "Polygroup PreLit Tree 2018",
+      .firmware_family = TWS_H,
+      .led_profile = TWS_RGB,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .sync_fml = TWS_Tree,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "PT600W01P08",
+      .commercial_name = "Polygroup PreLit Tree 2018",
+      .firmware_family = TWS_H,
+      .led_profile = TWS_RGB,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .sync_fml = TWS_Tree,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "PT600W01P09",
+      .commercial_name = "Polygroup PreLit Tree 2019",
+      .firmware_family = TWS_H,
+      .led_profile = TWS_RGB,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .sync_fml = TWS_Tree,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "PT750W01P09",
+      .commercial_name = "Polygroup PreLit Tree 2020",
+      .firmware_family = TWS_K,
+      .led_profile = TWS_RGB,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .sync_fml = TWS_Tree,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "PTT025STP",
+      .commercial_name = "Polygroup Tree Top Star G2",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 25,
+      .default_name = TWS_Topper,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_topper,
+      .mapping_allowed = true,
+      .sync_fml = TWS_Topper,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "SF030C20P",
+      .commercial_name = "Polygroup Pathway Light Snowflake 30L",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 30,
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_snowflake,
+      .mapping_allowed = false,
+      .sync_fml = TWS_Pathway,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "SF030C20P10E",
+      .commercial_name = "Polygroup Pathway Light Snowflake 30L",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 30,
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_snowflake,
+      .mapping_allowed = false,
+      .sync_fml = TWS_Pathway,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "SF045C04P",
+      .commercial_name = "Polygroup Pathway Light Snowflake 45L",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 45,
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_snowflake,
+      .mapping_allowed = false,
+      .sync_fml = TWS_Pathway,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "SF045C04P15E",
+      .commercial_name = "Polygroup Pathway Light Snowflake 45L",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 45,
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_snowflake,
+      .mapping_allowed = false,
+      .sync_fml = TWS_Pathway,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "SF045C20P",
+      .commercial_name = "Polygroup Pathway Light Snowflake 45L",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 45,
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_snowflake,
+      .mapping_allowed = false,
+      .sync_fml = TWS_Pathway,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "SF045C20P15E",
+      .commercial_name = "Polygroup Pathway Light Snowflake 45L",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 45,
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_snowflake,
+      .mapping_allowed = false,
+      .sync_fml = TWS_Pathway,
+      .bluetooth = false,
+      .microphone = false },
+    { .product_code = "SF060C011H",
       .commercial_name = "Polygroup Giant Snowflake 60L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 60,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "gsnowflake",
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_gsnowflake,
       .mapping_allowed = false,
-      .sync_fml = "Snowflake",
+      .sync_fml = TWS_Snowflake,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "SF060C20H",
       .commercial_name = "Polygroup Giant Snowflake 60L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 60,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "gsnowflake",
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_gsnowflake,
       .mapping_allowed = false,
-      .sync_fml = "Snowflake",
+      .sync_fml = TWS_Snowflake,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "SF060C20P",
       .commercial_name = "Polygroup Giant Snowflake 60L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 60,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "gsnowflake",
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_gsnowflake,
       .mapping_allowed = false,
-      .sync_fml = "Snowflake",
+      .sync_fml = TWS_Snowflake,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "SF090C011H",
       .commercial_name = "Polygroup Giant Snowflake 90L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 90,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "gsnowflake",
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_gsnowflake,
       .mapping_allowed = false,
-      .sync_fml = "Snowflake",
+      .sync_fml = TWS_Snowflake,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "SF090C01P",
       .commercial_name = "Polygroup Giant Snowflake 90L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 90,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "gsnowflake",
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_gsnowflake,
       .mapping_allowed = false,
-      .sync_fml = "Snowflake",
+      .sync_fml = TWS_Snowflake,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "SF090C20P",
       .commercial_name = "Polygroup Giant Snowflake 90L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 90,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "gsnowflake",
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_gsnowflake,
       .mapping_allowed = false,
-      .sync_fml = "Snowflake",
+      .sync_fml = TWS_Snowflake,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "SF120C011H",
       .commercial_name = "Polygroup Giant Snowflake 120L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 120,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "gsnowflake",
+      .default_name = TWS_Snowflake,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_gsnowflake,
       .mapping_allowed = false,
-      .sync_fml = "Snowflake",
+      .sync_fml = TWS_Snowflake,
       .bluetooth = false,
       .microphone = false },
+    { .product_code = "TC060SEUP07",
+      .commercial_name = "Twinkly Cone 60",
+      .firmware_family = TWS_E,
+      .led_profile = TWS_RGB,
+      .led_number = 60,
+      .default_name = TWS_Cone,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = false,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_cone },
     { .product_code = "TD160SEUP06",
       .commercial_name = "Twinkly Deer 160",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 80,
-      .default_name = "Deer",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Deer,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = false,
-      .sync_fml = "Deer",
+      .sync_fml = TWS_Deer,
       .bluetooth = false,
       .microphone = false,
-      .icon = "reindeer" },
+      .icon = TWS_reindeer },
     { .product_code = "TD160SEUP07",
       .commercial_name = "Twinkly Deer 160",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 80,
-      .default_name = "Deer",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Deer,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = false,
-      .sync_fml = "Deer",
+      .sync_fml = TWS_Deer,
       .bluetooth = false,
       .microphone = false,
-      .icon = "reindeer" },
+      .icon = TWS_reindeer },
     { .product_code = "TI1020SRUP07",
       .commercial_name = "Twinkly Curtain 200 RU",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 200,
-      .default_name = "Curtain",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .default_name = TWS_Curtain,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "TI120SEUP07",
       .commercial_name = "Twinkly Wall 120",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 120,
-      .default_name = "Wall",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .default_name = TWS_Wall,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "TI200SEUP07",
       .commercial_name = "Twinkly Wall 200",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 200,
-      .default_name = "Wall",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .default_name = TWS_Wall,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "TI200SEUP09",
       .commercial_name = "Twinkly Wall 200",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 200,
-      .default_name = "Wall",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .default_name = TWS_Wall,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "TI2011SRUP07",
       .commercial_name = "Twinkly Wall 220 RU",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 220,
-      .default_name = "Wall",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .default_name = TWS_Wall,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "TI2011SRUP09",
       .commercial_name = "Twinkly Wall 220 RU",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 220,
-      .default_name = "Wall",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .default_name = TWS_Wall,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "TI210SEUP07",
       .commercial_name = "Twinkly Curtain 210",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 210,
-      .default_name = "Curtain",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .default_name = TWS_Curtain,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
     { .product_code = "TI210SEUP09",
       .commercial_name = "Twinkly Curtain 210",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 210,
-      .default_name = "Curtain",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .default_name = TWS_Curtain,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_wall },
+    { .product_code = "TMD01USB",
+      .commercial_name = "Twinkly Music",
+      .firmware_family = TWS_TM,
+      .default_name = TWS_TwinklyMusic },
+    { .product_code = "TP035GEUP06",
+      .commercial_name = "Twinkly Wreath 35",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 35,
+      .default_name = TWS_Wreath,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = false,
+      .sync_fml = TWS_Wreath,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_wreath },
     { .product_code = "TP035TEUP07",
       .commercial_name = "Twinkly PreLit Tree 35",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 35,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .sync_fml = TWS_Tree,
       .bluetooth = false,
       .microphone = false,
-      .icon = "pre_lit_tree" },
+      .icon = TWS_pre_lit_tree },
     { .product_code = "TP035WEUP07",
       .commercial_name = "Twinkly Wreath 35",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 35,
-      .default_name = "Wreath",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Wreath,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = false,
-      .sync_fml = "Wreath",
+      .sync_fml = TWS_Wreath,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wreath" },
-    { .product_code = "TP035GEUP06",
-      .commercial_name = "Twinkly Wreath 35",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 35,
-      .default_name = "Wreath",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
-      .mapping_allowed = false,
-      .sync_fml = "Wreath",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "wreath" },
+      .icon = TWS_wreath },
     { .product_code = "TP056GEUP07",
       .commercial_name = "Twinkly Garland 56",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 56,
-      .default_name = "Garland",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Garland,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = false,
-      .sync_fml = "Garland",
+      .sync_fml = TWS_Garland,
       .bluetooth = false,
       .microphone = false,
-      .icon = "garland" },
+      .icon = TWS_garland },
     { .product_code = "TP056TEUP07",
       .commercial_name = "Twinkly PreLit Tree 56 (diventa GARLAND)",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 56,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .sync_fml = TWS_Tree,
       .bluetooth = false,
       .microphone = false,
-      .icon = "garland" },
+      .icon = TWS_garland },
     { .product_code = "TP070TEUP07",
       .commercial_name = "Twinkly PreLit Tree 70",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 70,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .sync_fml = TWS_Tree,
       .bluetooth = false,
       .microphone = false,
-      .icon = "pre_lit_tree" },
+      .icon = TWS_pre_lit_tree },
     { .product_code = "TP125TEUP07",
       .commercial_name = "Twinkly PreLit Tree 125",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 125,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .sync_fml = TWS_Tree,
       .bluetooth = false,
       .microphone = false,
-      .icon = "pre_lit_tree" },
+      .icon = TWS_pre_lit_tree },
     { .product_code = "TP220TEUP07",
       .commercial_name = "Twinkly PreLit Tree 220",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 220,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .sync_fml = TWS_Tree,
       .bluetooth = false,
       .microphone = false,
-      .icon = "pre_lit_tree" },
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TP255TEUP06",
+      .commercial_name = "Twinkly PreLit Tree 225",
+      .firmware_family = TWS_C,
+      .led_profile = TWS_RGB,
+      .led_number = 225,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .sync_fml = TWS_Tree,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_pre_lit_tree },
     { .product_code = "TP255TEUP07",
       .commercial_name = "Twinkly PreLit Tree 255",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 255,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .sync_fml = TWS_Tree,
       .bluetooth = false,
       .microphone = false,
-      .icon = "pre_lit_tree" },
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TP270TEUP07",
+      .commercial_name = "Twinkly PreLit Tree 270",
+      .firmware_family = TWS_C,
+      .led_profile = TWS_RGB,
+      .led_number = 270,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .sync_fml = TWS_Tree,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TP330TEUP07",
+      .commercial_name = "Twinkly PreLit Tree 330",
+      .firmware_family = TWS_C,
+      .led_profile = TWS_RGB,
+      .led_number = 330,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .sync_fml = TWS_Tree,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_pre_lit_tree },
     { .product_code = "TS170SEUP06",
       .commercial_name = "Twinkly Snowman 170",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 85,
-      .default_name = "Snowman",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Snowman,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = false,
-      .sync_fml = "Snowman",
+      .sync_fml = TWS_Snowman,
       .bluetooth = false,
       .microphone = false,
-      .icon = "snowman" },
+      .icon = TWS_snowman },
     { .product_code = "TS170SEUP07",
       .commercial_name = "Twinkly Snowman 170",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 85,
-      .default_name = "Snowman",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Snowman,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = false,
-      .sync_fml = "Snowman",
+      .sync_fml = TWS_Snowman,
       .bluetooth = false,
       .microphone = false,
-      .icon = "snowman" },
+      .icon = TWS_snowman },
     { .product_code = "TT025C01P25E",
       .commercial_name = "Polygroup Tree Topper 50L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 25,
-      .default_name = "Topper",
-      .layout_type = "2D",
-      .pixel_shape = "topper",
+      .default_name = TWS_Topper,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_topper,
       .mapping_allowed = true,
-      .sync_fml = "Topper",
+      .sync_fml = TWS_Topper,
       .bluetooth = false,
       .microphone = false },
     { .product_code = "TT025C20P25E",
       .commercial_name = "Polygroup Tree Topper 50L",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 25,
-      .default_name = "Topper",
-      .layout_type = "2D",
-      .pixel_shape = "topper",
+      .default_name = TWS_Topper,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_topper,
       .mapping_allowed = true,
-      .sync_fml = "Topper",
+      .sync_fml = TWS_Topper,
       .bluetooth = false,
       .microphone = false },
+    { .product_code = "TW056SEUM04",
+      .commercial_name = "Twinkly Strings 56",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
+      .led_number = 56,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "TW056SEUM05",
+      .commercial_name = "Twinkly Strings 56",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
+      .led_number = 56,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "TW056SEUM06",
+      .commercial_name = "Twinkly Strings 56",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
+      .led_number = 56,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "TW056SEUM07",
+      .commercial_name = "Twinkly Strings 56",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
+      .led_number = 56,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
+      .microphone = false,
+      .icon = TWS_string },
     { .product_code = "TW056SEUP06",
       .commercial_name = "Twinkly Strings 56",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "TW056SEUP07",
       .commercial_name = "Twinkly Strings 56",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "TW056SPXP09",
       .commercial_name = "Twinkly Strings 56 - Pallbox",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "TW056XEUP07",
       .commercial_name = "Twinkly Strings 56",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
       .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW105SEUP06",
-      .commercial_name = "Twinkly Strings 105",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 105,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW100",
+      .commercial_name = "Twinkly Strings (2016)",
+      .firmware_family = TWS_A,
+      .led_profile = TWS_RGB,
+      .led_number = 100,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW105SEUP07",
+      .icon = TWS_string },
+    { .product_code = "TW105SEUM04",
       .commercial_name = "Twinkly Strings 105",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
       .led_number = 105,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW105SEUP09",
+      .icon = TWS_string },
+    { .product_code = "TW105SEUM06",
       .commercial_name = "Twinkly Strings 105",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
       .led_number = 105,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW105XEUP07",
+      .icon = TWS_string },
+    { .product_code = "TW105SEUM07",
       .commercial_name = "Twinkly Strings 105",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
       .led_number = 105,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW175GEUP06",
-      .commercial_name = "Twinkly Strings 175 SE (RWB)",
-      .firmware_family = "D",
-      .led_profile = "RBW",
-      .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW105SEUP06",
+      .commercial_name = "Twinkly Strings 105",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 105,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RWB",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW175GEUP07",
-      .commercial_name = "Twinkly Strings 175 SE (RWB)",
-      .firmware_family = "D",
-      .led_profile = "RBW",
-      .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW105SEUP07",
+      .commercial_name = "Twinkly Strings 105",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 105,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RWB",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW175SEUP06",
-      .commercial_name = "Twinkly Strings 175",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW105SEUP09",
+      .commercial_name = "Twinkly Strings 105",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 105,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW175SEUP07",
-      .commercial_name = "Twinkly Strings 175",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW105XEUP07",
+      .commercial_name = "Twinkly Strings 105",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 105,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW175SEUP09",
-      .commercial_name = "Twinkly Strings 175",
-      .firmware_family = "D",
-      .led_profile = "RGB",
+      .icon = TWS_string },
+    { .product_code = "TW175GEUP06",
+      .commercial_name = "Twinkly Strings 175 SE (RWB)",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RBW,
       .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings_RWB,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW175WEUP07",
+      .icon = TWS_string },
+    { .product_code = "TW175GEUP07",
       .commercial_name = "Twinkly Strings 175 SE (RWB)",
-      .firmware_family = "D",
-      .led_profile = "RBW",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RBW,
       .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RWB",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings_RWB,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW225GEUP07",
-      .commercial_name = "Twinkly Strings 225 SE (RWB)",
-      .firmware_family = "D",
-      .led_profile = "RBW",
-      .led_number = 225,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings-RWB",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW225SEUP06",
-      .commercial_name = "Twinkly Strings 225",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 225,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW225SEUP07",
-      .commercial_name = "Twinkly Strings 225",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 225,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW225SEUP09",
-      .commercial_name = "Twinkly Strings 225",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 225,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TW225WEUP07",
-      .commercial_name = "Twinkly Strings 225 SE (RWB)",
-      .firmware_family = "D",
-      .led_profile = "RBW",
-      .led_number = 225,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TX170SEUP07",
-      .commercial_name = "Twinkly Snowman 170",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 85,
-      .default_name = "Snowman",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = false,
-      .sync_fml = "Snowman",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "snowman" },
-    { .product_code = "U 1SDPP",
-      .commercial_name = "Twinkly Strings 225",
-      .firmware_family = "D",
-      .led_profile = "RGB",
-      .led_number = 225,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TC060SEUP07",
-      .commercial_name = "Twinkly Cone 60",
-      .firmware_family = "E",
-      .led_profile = "RGB",
-      .led_number = 60,
-      .default_name = "Cone",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
-      .mapping_allowed = false,
-      .bluetooth = false,
-      .microphone = false,
-      .icon = "cone" },
-    { .product_code = "MN800EUP00",
-      .commercial_name = "Minleon Lora - UNICORN - Twinkly",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 800,
-      .bluetooth = false,
-      .microphone = false },
-    { .product_code = "PCPM015STP",
-      .commercial_name = "Polygroup Candy Cane Pathway Markers G2",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 15,
-      .default_name = "Candy Cane",
-      .layout_type = "2D",
-      .pixel_shape = "candycane",
-      .mapping_allowed = false,
-      .join_fml = "CandyCane",
-      .sync_fml = "Pathway",
-      .bluetooth = false,
-      .microphone = false },
-    { .product_code = "PCT090STP",
-      .commercial_name = "Polygroup Cone Tree G2",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 90,
-      .default_name = "Cone",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .sync_fml = "ConeTree",
-      .bluetooth = false,
-      .microphone = false },
-    { .product_code = "PGI050GOP",
-      .commercial_name = "Polygroup Icicle G2 AWW 50L",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 50,
-      .default_name = "Icicle",
-      .layout_type = "Icicle",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Icicle",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "wall" },
-    { .product_code = "PGI190GOP",
-      .commercial_name = "Polygroup Icicle G2 AWW 190L",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 190,
-      .default_name = "Icicle",
-      .layout_type = "Icicle",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Icicle",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "wall" },
-    { .product_code = "PGI190STP",
-      .commercial_name = "Polygroup Icicle G2 RGB 190L",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 190,
-      .default_name = "Icicle",
-      .layout_type = "Icicle",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Icicle",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "wall" },
-    { .product_code = "PGS050GOP",
-      .commercial_name = "Polygroup Led Lights G2 AWW 50L",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 50,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings-AWW",
-      .sync_fml = "Strings",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS050STP",
-      .commercial_name = "Polygroup Led Lights G2 RGB 50L",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 50,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS056GOP",
-      .commercial_name = "Polygroup Led Lights G2 AWW 56L",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 56,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings-AWW",
-      .sync_fml = "Strings",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS060STP",
-      .commercial_name = "Polygroup Giant Snowflake G2",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 60,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "gsnowflake",
-      .mapping_allowed = false,
-      .sync_fml = "Snowflake",
-      .bluetooth = false,
-      .microphone = false },
-    { .product_code = "PGS100GOP",
-      .commercial_name = "Polygroup Led Lights G2 AWW 100L",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 100,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings-AWW",
-      .sync_fml = "Strings",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS100STP",
-      .commercial_name = "Polygroup Led Lights G2 RGB 100L",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 100,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW175SEUM04",
+      .commercial_name = "Twinkly Strings 175",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
+      .led_number = 175,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS105GOP",
-      .commercial_name = "Polygroup Led Lights G2 AWW 105L",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 105,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW175SEUM06",
+      .commercial_name = "Twinkly Strings 175",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
+      .led_number = 175,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-AWW",
-      .sync_fml = "Strings",
-      .bluetooth = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS150GOP",
-      .commercial_name = "Polygroup Led Lights G2 AWW 150L",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 150,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW175SEUM07",
+      .commercial_name = "Twinkly Strings 175",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
+      .led_number = 175,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-AWW",
-      .sync_fml = "Strings",
-      .bluetooth = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS150STP",
-      .commercial_name = "Polygroup Led Lights G2 RGB 150L",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 150,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW175SEUP06",
+      .commercial_name = "Twinkly Strings 175",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 175,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS250GOP",
-      .commercial_name = "Polygroup Led Lights G2 AWW 250L",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 250,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW175SEUP07",
+      .commercial_name = "Twinkly Strings 175",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 175,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-AWW",
-      .sync_fml = "Strings",
-      .bluetooth = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS250STP",
-      .commercial_name = "Polygroup Led Lights G2 RGB 250L",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 250,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW175SEUP09",
+      .commercial_name = "Twinkly Strings 175",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 175,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS400GOP",
-      .commercial_name = "Polygroup Led Lights G2 AWW 400L",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 400,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW175WEUP07",
+      .commercial_name = "Twinkly Strings 175 SE (RWB)",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RBW,
+      .led_number = 175,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-AWW",
-      .sync_fml = "Strings",
-      .bluetooth = true,
+      .join_fml = TWS_Strings_RWB,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS400STP",
-      .commercial_name = "Polygroup Led Lights G2 RGB 400L",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 400,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW2016",
+      .commercial_name = "Twinkly Strings (2016)",
+      .firmware_family = TWS_A,
+      .led_profile = TWS_RGB,
+      .led_number = 100,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PIC050STP",
-      .commercial_name = "Polygroup Icicle Style LED Wrapped Dome G2",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 50,
-      .default_name = "Icicle",
-      .layout_type = "Icicle",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW224SEUM04",
+      .commercial_name = "Twinkly (2017)",
+      .firmware_family = TWS_B,
+      .led_profile = TWS_RGB,
+      .led_number = 224,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Icicle",
-      .sync_fml = "Icicle",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
-    { .product_code = "PLI005STP",
-      .commercial_name = "Polygroup Large Icicle LED lights G2",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 5,
-      .default_name = "Icicle",
-      .layout_type = "Linear",
-      .pixel_shape = "Icicle",
+      .icon = TWS_string },
+    { .product_code = "TW225GEUP07",
+      .commercial_name = "Twinkly Strings 225 SE (RWB)",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RBW,
+      .led_number = 225,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "IcicleLed",
-      .sync_fml = "IcicleLed",
+      .join_fml = TWS_Strings_RWB,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
-      .microphone = false },
-    { .product_code = "PNE080STP",
-      .commercial_name = "Polygroup Net Style LED Mini Dome G2",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 80,
-      .default_name = "Net",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "TW225SEUP06",
+      .commercial_name = "Twinkly Strings 225",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 225,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "wall" },
-    { .product_code = "POS020STP",
-      .commercial_name = "Polygroup One String C7 / C9 / C12 / G35 G2",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 20,
-      .default_name = "One String",
-      .layout_type = "Linear",
-      .pixel_shape = "c7",
+      .icon = TWS_string },
+    { .product_code = "TW225SEUP07",
+      .commercial_name = "Twinkly Strings 225",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 225,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "POS040STP",
-      .commercial_name = "Polygroup Garland Style LED lights G2",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 40,
-      .default_name = "Garland",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TW225SEUP09",
+      .commercial_name = "Twinkly Strings 225",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 225,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = false,
-      .microphone = false },
-    { .product_code = "PSPM030STP",
-      .commercial_name = "Polygroup Snowflake Pathway Markers G2",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 30,
-      .default_name = "Snowflake",
-      .layout_type = "2D",
-      .pixel_shape = "snowflake",
-      .mapping_allowed = false,
-      .sync_fml = "Pathway",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = false,
-      .microphone = false },
-    { .product_code = "PTT025STP",
-      .commercial_name = "Polygroup Tree Top Star G2",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 25,
-      .default_name = "Topper",
-      .layout_type = "2D",
-      .pixel_shape = "topper",
+      .microphone = false,
+      .icon = TWS_string },
+    { .product_code = "TW225WEUP07",
+      .commercial_name = "Twinkly Strings 225 SE (RWB)",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RBW,
+      .led_number = 225,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Topper",
       .bluetooth = false,
-      .microphone = false },
+      .microphone = false,
+      .icon = TWS_string },
     { .product_code = "TWB200STP",
       .commercial_name = "Twinkly Spritzer 200",
-      .firmware_family = "F",
-      .led_profile = "RGB",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
       .led_number = 200,
-      .default_name = "Spritzer",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Spritzer,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Spritzer",
+      .sync_fml = TWS_Spritzer,
       .bluetooth = true,
       .microphone = false,
-      .icon = "spritzer" },
+      .icon = TWS_spritzer },
     { .product_code = "TWC400GOP",
       .commercial_name = "Twinkly Cluster 400 GE (AWW)",
-      .firmware_family = "F",
-      .led_profile = "AWW",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
       .led_number = 400,
-      .default_name = "Cluster",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Cluster,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-AWW",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings_AWW,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "cluster" },
+      .icon = TWS_cluster },
     { .product_code = "TWC400STP",
       .commercial_name = "Twinkly Cluster 400",
-      .firmware_family = "F",
-      .led_profile = "RGB",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
       .led_number = 400,
-      .default_name = "Cluster",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Cluster,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "cluster" },
+      .icon = TWS_cluster },
     { .product_code = "TWF020STP",
       .commercial_name = "Twinkly Festoon",
-      .firmware_family = "F",
-      .led_profile = "RGB",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
       .led_number = 20,
-      .default_name = "Festoon",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Festoon,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "TWF020STP-B",
       .commercial_name = "Twinkly Festoon",
-      .firmware_family = "F",
-      .led_profile = "RGB",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
       .led_number = 20,
-      .default_name = "Festoon",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .default_name = TWS_Festoon,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWI190GOP",
-      .commercial_name = "Twinkly Icicle 190",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 190,
-      .default_name = "Icicle",
-      .layout_type = "Icicle",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWG050SPP",
+      .commercial_name = "Twinkly Garland 50",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 50,
+      .default_name = TWS_Garland,
+      .layout_type = TWS_Linear,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Icicle",
       .bluetooth = true,
       .microphone = false,
-      .icon = "wall" },
-    { .product_code = "TWI190GOP-T",
-      .commercial_name = "Twinkly Icicle 190",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 190,
-      .default_name = "Icicle",
-      .layout_type = "Icicle",
-      .pixel_shape = "dot",
+      .icon = TWS_garland },
+    { .product_code = "TWH600STP",
+      .commercial_name = "Peachtree",
+      .firmware_family = TWS_L,
+      .led_profile = TWS_RGB,
+      .led_number = 600,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Icicle",
+      .sync_fml = TWS_Tree,
       .bluetooth = true,
       .microphone = false,
-      .icon = "wall" },
-    { .product_code = "TWI190STP",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWI190GOP",
       .commercial_name = "Twinkly Icicle 190",
-      .firmware_family = "F",
-      .led_profile = "RGB",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
       .led_number = 190,
-      .default_name = "Icicle",
-      .layout_type = "Icicle",
-      .pixel_shape = "dot",
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Icicle,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Icicle",
+      .sync_fml = TWS_Icicle,
       .bluetooth = true,
       .microphone = false,
-      .icon = "wall" },
-    { .product_code = "TWI190STP-T",
+      .icon = TWS_wall },
+    { .product_code = "TWI190GOP-T",
       .commercial_name = "Twinkly Icicle 190",
-      .firmware_family = "F",
-      .led_profile = "RGB",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
       .led_number = 190,
-      .default_name = "Icicle",
-      .layout_type = "Icicle",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .sync_fml = "Icicle",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "wall" },
-    { .product_code = "TWS075SUP-B",
-      .commercial_name = "Twinkly Strings 75",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 75,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS100STP",
-      .commercial_name = "Twinkly Strings 100",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 100,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS150STP",
-      .commercial_name = "Twinkly Strings 150",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 150,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS150STP-B",
-      .commercial_name = "Twinkly Strings 150",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 150,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS175STP",
-      .commercial_name = "Twinkly Strings 175 GEN II",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 175,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS250GOP",
-      .commercial_name = "Twinkly Strings 250 GE (AWW)",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 250,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings-AWW",
-      .sync_fml = "Strings",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS250GOP-B",
-      .commercial_name = "Twinkly Strings 250 GE (AWW)",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 250,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings-AWW",
-      .sync_fml = "Strings",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS250STP",
-      .commercial_name = "Twinkly Strings 250",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 250,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS250STP-B",
-      .commercial_name = "Twinkly Strings 250",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 250,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Icicle,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .sync_fml = TWS_Icicle,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS400GOP",
-      .commercial_name = "Twinkly Strings 400 GE (AWW)",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 400,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_wall },
+    { .product_code = "TWI190SPP",
+      .commercial_name = "Twinkly Icicle 190",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 190,
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-AWW",
-      .sync_fml = "Strings",
+      .sync_fml = TWS_Icicle,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS400STP",
-      .commercial_name = "Twinkly Strings 400",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 400,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_wall },
+    { .product_code = "TWI190SPP-T",
+      .commercial_name = "Twinkly Icicle 190",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 190,
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .sync_fml = TWS_Icicle,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS400STP-B",
-      .commercial_name = "Twinkly Strings 400",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 400,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_wall },
+    { .product_code = "TWI190STP",
+      .commercial_name = "Twinkly Icicle 190",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 190,
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Icicle,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .sync_fml = TWS_Icicle,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS400SXP",
-      .commercial_name = "Twinkly Strings 400 (Interactive Tree)",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 400,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_wall },
+    { .product_code = "TWI190STP-T",
+      .commercial_name = "Twinkly Icicle 190",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 190,
+      .default_name = TWS_Icicle,
+      .layout_type = TWS_Icicle,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .sync_fml = TWS_Icicle,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWT250GOP",
-      .commercial_name = "Twinkly PreLit 250 AWW",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 250,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_wall },
+    { .product_code = "TWP1000ETH",
+      .commercial_name = "Twinkly Pro - Beta board",
+      .led_profile = TWS_RGB,
+      .led_number = 1000,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWT250STP",
-      .commercial_name = "Twinkly PreLit 250 RGB",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 250,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWPRO1000ETHP",
+      .commercial_name = "Twinkly Pro",
+      .led_profile = TWS_RGB,
+      .led_number = 1000,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWT400GOP",
-      .commercial_name = "Twinkly PreLit 400 AWW",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 400,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWPRO1000ETHS",
+      .commercial_name = "Twinkly Pro",
+      .led_profile = TWS_RGB,
+      .led_number = 1000,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWT400STP",
-      .commercial_name = "Twinkly PreLit 400 RGB",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 400,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWPRO1500ETHP",
+      .commercial_name = "Twinkly Pro V2",
+      .led_profile = TWS_RGB,
+      .led_number = 1500,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWT500GOP",
-      .commercial_name = "Twinkly PreLit 500 AWW",
-      .firmware_family = "F",
-      .led_profile = "AWW",
-      .led_number = 500,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWPRO400WRLP",
+      .commercial_name = "Twinkly Pro Wifi",
+      .firmware_family = TWS_P,
+      .led_profile = TWS_RGB,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWT500STP",
-      .commercial_name = "Twinkly PreLit 500 RGB",
-      .firmware_family = "F",
-      .led_profile = "RGB",
-      .led_number = 500,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWPRO400WRLP-TS",
+      .commercial_name = "Twinkly Pro Wifi",
+      .firmware_family = TWS_P,
+      .led_profile = TWS_RGB,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "MF150BRTHD",
-      .commercial_name = "Twinkly MF Edition",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 150,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWPRO400WRLS",
+      .commercial_name = "Twinkly Pro Wifi",
+      .firmware_family = TWS_P,
+      .led_profile = TWS_RGB,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RGBW",
-      .sync_fml = "Strings",
-      .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "MN800EUS00",
-      .commercial_name = "Minleon Lora - UNICORN - SPI",
-      .firmware_family = "G",
-      .led_profile = "RGB",
-      .led_number = 800,
-      .bluetooth = false,
-      .microphone = false },
+      .icon = TWS_string },
+    { .product_code = "TWPRO500WRLP",
+      .commercial_name = "Twinkly Pro Wifi",
+      .firmware_family = TWS_P,
+      .led_profile = TWS_RGB,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = true,
+      .microphone = false,
+      .icon = TWS_string },
     { .product_code = "TWR050SPP",
       .commercial_name = "Twinkly Wreath 50",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
       .led_number = 50,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RGBW",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings_RGBW,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS050SPP",
-      .commercial_name = "Polygroup Led Lights G2 RGBW 50L",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 50,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWS075SUP-B",
+      .commercial_name = "Twinkly Strings 75",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 75,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RGBW",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS100SPP",
-      .commercial_name = "Polygroup Led Lights G2 RGBW 100L",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
+      .icon = TWS_string },
+    { .product_code = "TWS100STP",
+      .commercial_name = "Twinkly Strings 100",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
       .led_number = 100,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RGBW",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS150SPP",
-      .commercial_name = "Polygroup Led Lights G2 RGBW 150L",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
+      .icon = TWS_string },
+    { .product_code = "TWS150STP",
+      .commercial_name = "Twinkly Strings 150",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
       .led_number = 150,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RGBW",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS250SPP",
-      .commercial_name = "Polygroup Led Lights G2 RGBW 250L",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 250,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWS150STP-B",
+      .commercial_name = "Twinkly Strings 150",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 150,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RGBW",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "PGS400SPP",
-      .commercial_name = "Polygroup Led Lights G2 RGBW 400L",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 400,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWS175STP",
+      .commercial_name = "Twinkly Strings 175 GEN II",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 175,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RGBW",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWI190SPP",
-      .commercial_name = "Twinkly Icicle 190",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 190,
-      .default_name = "Icicle",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWS250GOP",
+      .commercial_name = "Twinkly Strings 250 GE (AWW)",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 250,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Icicle",
+      .join_fml = TWS_Strings_AWW,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "wall" },
-    { .product_code = "TWI190SPP-T",
-      .commercial_name = "Twinkly Icicle 190",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 190,
-      .default_name = "Icicle",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWS250GOP-B",
+      .commercial_name = "Twinkly Strings 250 GE (AWW)",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 250,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Icicle",
+      .join_fml = TWS_Strings_AWW,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "wall" },
+      .icon = TWS_string },
     { .product_code = "TWS250SPP",
       .commercial_name = "Twinkly Strings 250 SE (RGBW)",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
       .led_number = 250,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RGBW",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings_RGBW,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "TWS250SPP-B",
       .commercial_name = "Twinkly Strings 250 SE (RGBW)",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
       .led_number = 250,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RGBW",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings_RGBW,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_string },
     { .product_code = "TWS250SPP-T",
       .commercial_name = "Twinkly Strings 250 SE (RGBW)",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
       .led_number = 250,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RGBW",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings_RGBW,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS400SPP",
-      .commercial_name = "Twinkly Strings 400 SE (RGBW)",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 400,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWS250STP",
+      .commercial_name = "Twinkly Strings 250",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 250,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings-RGBW",
-      .sync_fml = "Strings",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWST250SPP",
-      .commercial_name = "Twinkly PreLit String 250",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
+      .icon = TWS_string },
+    { .product_code = "TWS250STP-B",
+      .commercial_name = "Twinkly Strings 250",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
       .led_number = 250,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWST400SPP",
-      .commercial_name = "Twinkly PreLit String 400",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
+      .icon = TWS_string },
+    { .product_code = "TWS400GOP",
+      .commercial_name = "Twinkly Strings 400 GE (AWW)",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
       .led_number = 400,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .join_fml = TWS_Strings_AWW,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWST500SPP",
-      .commercial_name = "Twinkly PreLit String 500",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 500,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = true,
-      .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWT200SPP",
-      .commercial_name = "Twinkly PreLit 200",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 200,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWS400SPP",
+      .commercial_name = "Twinkly Strings 400 SE (RGBW)",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 400,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .join_fml = TWS_Strings_RGBW,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWT300SPP",
-      .commercial_name = "Twinkly PreLit 300",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 300,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWS400STP",
+      .commercial_name = "Twinkly Strings 400",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 400,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWT400S2P",
-      .commercial_name = "Twinkly PreLit 400",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
+      .icon = TWS_string },
+    { .product_code = "TWS400STP-B",
+      .commercial_name = "Twinkly Strings 400",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
       .led_number = 400,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWT400S3P",
-      .commercial_name = "Twinkly PreLit 400 RGBW",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
+      .icon = TWS_string },
+    { .product_code = "TWS400SXP",
+      .commercial_name = "Twinkly Strings 400 (Interactive Tree)",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
       .led_number = 400,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWT400SPP",
-      .commercial_name = "Twinkly PreLit 400 RGBW",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 400,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWS600STP",
+      .commercial_name = "Twinkly Strings 600",
+      .firmware_family = TWS_M,
+      .led_profile = TWS_RGB,
+      .led_number = 600,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWT500SPP",
-      .commercial_name = "Twinkly PreLit 500",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 500,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWSFIERA300",
+      .commercial_name = "Twinkly FIERA 2020",
+      .firmware_family = TWS_M,
+      .led_profile = TWS_RGB,
+      .led_number = 310,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWTS500SPP",
-      .commercial_name = "Twinkly PreLit String 500",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 500,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_string },
+    { .product_code = "TWST250SPP",
+      .commercial_name = "Twinkly PreLit String 250",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 250,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .sync_fml = TWS_Tree,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWW210SPP",
-      .commercial_name = "Twinkly Wall 210",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 210,
-      .default_name = "Wall",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWST400SPP",
+      .commercial_name = "Twinkly PreLit String 400",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 400,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .sync_fml = TWS_Tree,
       .bluetooth = true,
       .microphone = false,
-      .icon = "wall" },
-    { .product_code = "TWW210SPP-T",
-      .commercial_name = "Twinkly Wall 210",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 210,
-      .default_name = "Wall",
-      .layout_type = "Matrix",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWST500SPP",
+      .commercial_name = "Twinkly PreLit String 500",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 500,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Matrix",
-      .sync_fml = "Matrix",
+      .sync_fml = TWS_Tree,
       .bluetooth = true,
       .microphone = false,
-      .icon = "wall" },
-    { .product_code = "TWG050SPP",
-      .commercial_name = "Twinkly Garland 50",
-      .firmware_family = "G",
-      .led_profile = "RGBW",
-      .led_number = 50,
-      .default_name = "Garland",
-      .layout_type = "Linear",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWST650SPP",
+      .commercial_name = "Twinkly PreLit String 650",
+      .firmware_family = TWS_N,
+      .led_profile = TWS_RGBW,
+      .led_number = 650,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
+      .sync_fml = TWS_Tree,
       .bluetooth = true,
       .microphone = false,
-      .icon = "garland" },
-    { .product_code = "PT600W00P08",
-      .commercial_name = "Polygroup PreLit Tree 2018",
-      .firmware_family = "H",
-      .led_profile = "RGB",
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWT200SPP",
+      .commercial_name = "Twinkly PreLit 200",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 200,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = false,
+      .sync_fml = TWS_Tree,
+      .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "PT600W01P08",
-      .commercial_name = "Polygroup PreLit Tree 2018",
-      .firmware_family = "H",
-      .led_profile = "RGB",
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWT250GOP",
+      .commercial_name = "Twinkly PreLit 250 AWW",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 250,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = false,
+      .sync_fml = TWS_Tree,
+      .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "PT600W01P09",
-      .commercial_name = "Polygroup PreLit Tree 2019",
-      .firmware_family = "H",
-      .led_profile = "RGB",
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWT250STP",
+      .commercial_name = "Twinkly PreLit 250 RGB",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 250,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = false,
+      .sync_fml = TWS_Tree,
+      .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "LS060C09PRP",
-      .commercial_name = "Polygroup Led Strip 60L",
-      .firmware_family = "J",
-      .led_profile = "RGB",
-      .led_number = 60,
-      .default_name = "Led Strip",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWT300SPP",
+      .commercial_name = "Twinkly PreLit 300",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 300,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strip",
-      .sync_fml = "Strip",
-      .bluetooth = false,
+      .sync_fml = TWS_Tree,
+      .bluetooth = true,
       .microphone = false,
-      .icon = "strip" },
-    { .product_code = "LS100C09PRP",
-      .commercial_name = "Polygroup Led Strip 100L",
-      .firmware_family = "J",
-      .led_profile = "RGB",
-      .led_number = 100,
-      .default_name = "Led Strip",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWT400GOP",
+      .commercial_name = "Twinkly PreLit 400 AWW",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 400,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strip",
-      .sync_fml = "Strip",
-      .bluetooth = false,
+      .sync_fml = TWS_Tree,
+      .bluetooth = true,
       .microphone = false,
-      .icon = "strip" },
-    { .product_code = "LS100C20PRP",
-      .commercial_name = "Polygroup Led Strip 100L",
-      .firmware_family = "J",
-      .led_profile = "RGB",
-      .led_number = 100,
-      .default_name = "Led Strip",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWT400S2P",
+      .commercial_name = "Twinkly PreLit 400",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 400,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strip",
-      .sync_fml = "Strip",
-      .bluetooth = false,
+      .sync_fml = TWS_Tree,
+      .bluetooth = true,
       .microphone = false,
-      .icon = "strip" },
-    { .product_code = "PT750W01P09",
-      .commercial_name = "Polygroup PreLit Tree 2020",
-      .firmware_family = "K",
-      .led_profile = "RGB",
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWT400S3P",
+      .commercial_name = "Twinkly PreLit 400 RGBW",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 400,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
-      .bluetooth = false,
+      .sync_fml = TWS_Tree,
+      .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "PGT750STP",
-      .commercial_name = "Polygroup PreLit Tree 2020 - GEN II",
-      .firmware_family = "L",
-      .led_profile = "RGB",
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWT400SPP",
+      .commercial_name = "Twinkly PreLit 400 RGBW",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 400,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .sync_fml = TWS_Tree,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWH600STP",
-      .commercial_name = "Peachtree",
-      .firmware_family = "L",
-      .led_profile = "RGB",
-      .led_number = 600,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWT400STP",
+      .commercial_name = "Twinkly PreLit 400 RGB",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 400,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .sync_fml = TWS_Tree,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "PGS600STP",
-      .commercial_name = "Polygroup Led Lights G2 RGB 600L",
-      .firmware_family = "M",
-      .led_profile = "RGB",
-      .led_number = 600,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWT500GOP",
+      .commercial_name = "Twinkly PreLit 500 AWW",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_AWW,
+      .led_number = 500,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .sync_fml = TWS_Tree,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWS600STP",
-      .commercial_name = "Twinkly Strings 600",
-      .firmware_family = "M",
-      .led_profile = "RGB",
-      .led_number = 600,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWT500SPP",
+      .commercial_name = "Twinkly PreLit 500",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 500,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .sync_fml = TWS_Tree,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWSFIERA300",
-      .commercial_name = "Twinkly FIERA 2020",
-      .firmware_family = "M",
-      .led_profile = "RGB",
-      .led_number = 310,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWT500STP",
+      .commercial_name = "Twinkly PreLit 500 RGB",
+      .firmware_family = TWS_F,
+      .led_profile = TWS_RGB,
+      .led_number = 500,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .join_fml = "Strings",
-      .sync_fml = "Strings",
+      .sync_fml = TWS_Tree,
       .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
+      .icon = TWS_pre_lit_tree },
     { .product_code = "TWT570STP",
       .commercial_name = "Twinkly PreLit Tree 570 - National",
-      .firmware_family = "M",
-      .led_profile = "RGB",
+      .firmware_family = TWS_M,
+      .led_profile = TWS_RGB,
       .led_number = 570,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .sync_fml = TWS_Tree,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "PGT750SPP",
-      .commercial_name = "Polygroup PreLit Tree 2020 - GEN II RGBW",
-      .firmware_family = "N",
-      .led_profile = "RGBW",
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWTS500SPP",
+      .commercial_name = "Twinkly PreLit String 500",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 500,
+      .default_name = TWS_Tree,
+      .layout_type = TWS_Vertical,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .sync_fml = TWS_Tree,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWST650SPP",
-      .commercial_name = "Twinkly PreLit String 650",
-      .firmware_family = "N",
-      .led_profile = "RGBW",
-      .led_number = 650,
-      .default_name = "Tree",
-      .layout_type = "Vertical",
-      .pixel_shape = "dot",
+      .icon = TWS_pre_lit_tree },
+    { .product_code = "TWW210SPP",
+      .commercial_name = "Twinkly Wall 210",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 210,
+      .default_name = TWS_Wall,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
-      .sync_fml = "Tree",
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
       .bluetooth = true,
       .microphone = false,
-      .icon = "pre_lit_tree" },
-    { .product_code = "TWPRO400WRLP",
-      .commercial_name = "Twinkly Pro Wifi",
-      .firmware_family = "P",
-      .led_profile = "RGB",
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWPRO400WRLP-TS",
-      .commercial_name = "Twinkly Pro Wifi",
-      .firmware_family = "P",
-      .led_profile = "RGB",
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_wall },
+    { .product_code = "TWW210SPP-T",
+      .commercial_name = "Twinkly Wall 210",
+      .firmware_family = TWS_G,
+      .led_profile = TWS_RGBW,
+      .led_number = 210,
+      .default_name = TWS_Wall,
+      .layout_type = TWS_Matrix,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
+      .join_fml = TWS_Matrix,
+      .sync_fml = TWS_Matrix,
+      .bluetooth = true,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWPRO400WRLS",
-      .commercial_name = "Twinkly Pro Wifi",
-      .firmware_family = "P",
-      .led_profile = "RGB",
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
+      .icon = TWS_wall },
+    { .product_code = "TX170SEUP07",
+      .commercial_name = "Twinkly Snowman 170",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 85,
+      .default_name = TWS_Snowman,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
+      .mapping_allowed = false,
+      .sync_fml = TWS_Snowman,
+      .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TWPRO500WRLP",
-      .commercial_name = "Twinkly Pro Wifi",
-      .firmware_family = "P",
-      .led_profile = "RGB",
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
+      .icon = TWS_snowman },
+    { .product_code = "U 1SDPP",
+      .commercial_name = "Twinkly Strings 225",
+      .firmware_family = TWS_D,
+      .led_profile = TWS_RGB,
+      .led_number = 225,
+      .default_name = TWS_Strings,
+      .layout_type = TWS_2D,
+      .pixel_shape = TWS_dot,
       .mapping_allowed = true,
+      .join_fml = TWS_Strings,
+      .sync_fml = TWS_Strings,
+      .bluetooth = false,
       .microphone = false,
-      .icon = "string" },
-    { .product_code = "TMD01USB",
-      .commercial_name = "Twinkly Music",
-      .firmware_family = "TM",
-      .default_name = "TwinklyMusic" },
-    { .product_code = "PLT300STP-G" },
-    { .product_code = "PLT400STP-G" },
-    { .product_code = "PLT490STP-G" },
-    { .product_code = "PLT495STP-G" },
-    { .product_code = "TWP1000ETH",
-      .commercial_name = "Twinkly Pro - Beta board",
-      .led_profile = "RGB",
-      .led_number = 1000,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .icon = "string" },
-    { .product_code = "TWPRO1000ETHP",
-      .commercial_name = "Twinkly Pro",
-      .led_profile = "RGB",
-      .led_number = 1000,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .icon = "string" },
-    { .product_code = "TWPRO1000ETHS",
-      .commercial_name = "Twinkly Pro",
-      .led_profile = "RGB",
-      .led_number = 1000,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .icon = "string" },
-    { .product_code = "TWPRO1500ETHP",
-      .commercial_name = "Twinkly Pro V2",
-      .led_profile = "RGB",
-      .led_number = 1500,
-      .default_name = "Strings",
-      .layout_type = "2D",
-      .pixel_shape = "dot",
-      .mapping_allowed = true,
-      .icon = "string" }
+      .icon = TWS_string }
 };
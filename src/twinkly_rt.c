@@ -0,0 +1,806 @@
+/*
+ * Copyright 2020 d4rkmen <darkmen@i.ua>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "mgos.h"
+#include "common/cs_base64.h"
+#include "mgos_twinkly.h"
+#include "twinkly_internal.h"
+
+#define RT_TOKEN_LEN     8
+#define RT_HEADER_V1_LEN 10 // 0x01, token, leds number
+#define RT_HEADER_V2_LEN 10 // 0x02, token, 0x00
+#define RT_HEADER_V3_LEN 12 // 0x03, token, 0x00 0x00, fragment number
+#define RT_FRAGMENT_LEN  900
+#define RT_FPS_DEFAULT   25.0
+#define RT_JITTER_EWMA   8 // jitter average weight, 1/N
+#define RT_KEEPALIVE_US  ((int64_t)(MGOS_TWINKLY_RT_KEEPALIVE_S * 1000000))
+#define RT_STORE_FRESH   0x4 // middle buffer holds an unconsumed frame
+
+// Tick scheduler on a fixed deadline grid
+struct rt_pacer {
+    float fps;
+    int64_t period_us;
+    int64_t next_us; // next tick deadline, mgos_uptime_micros() based
+    mgos_timer_id timer;
+    timer_callback cb;
+    void* arg;
+    uint32_t ticks_late;
+    uint32_t ticks_skipped;
+    uint32_t jitter_avg_us;
+    uint32_t jitter_max_us;
+};
+
+struct mgos_twinkly_rt_group {
+    struct twinkly_rt** members; // canvas is split between members in this order
+    int members_cnt;
+    uint8_t* canvas; // canonical RGB
+    size_t leds;
+    mgos_twinkly_rt_source_t source;
+    void* source_arg;
+    struct rt_pacer pacer;
+    struct mgos_twinkly_rt_group_stats stats;
+};
+
+// Triple buffer, lock-free single producer / single consumer handoff.
+// Producer renders into back and swaps it with middle, consumer swaps front with middle if fresh.
+struct mgos_twinkly_rt_store {
+    uint8_t* buf[3]; // canonical RGB
+    size_t leds;
+    uint32_t back;   // producer owned
+    uint32_t front;  // consumer owned
+    uint32_t middle; // buffer index | RT_STORE_FRESH, accessed atomically only
+    uint32_t published;
+    uint32_t dropped;      // published frames overwritten before the consumer took them
+    struct twinkly_rt* rt; // consumer stream, main loop only, NULL once the stream is gone
+};
+
+struct twinkly_rt {
+    struct mg_str ip;
+    struct mg_connection* c; // UDP
+    uint8_t proto;
+    uint8_t token[RT_TOKEN_LEN];
+    bool starting; // led/mode request is in progress
+    bool stopped;  // stopped while starting, freed by rt_mode_cb
+    bool active;   // device is in rt mode and token is known
+    int leds;
+    int bpl;                         // bytes per LED
+    mgos_twinkly_pixel_fn_t convert; // canonical RGB to led_profile wire format
+    struct mgos_twinkly_lut* lut;    // color correction, NULL if not set
+    uint8_t* rgb;                    // corrected canonical frame
+    uint8_t* pkt; // datagram buffer
+    tw_cb_t cb;   // start result
+    void* arg;
+    // Pacing, ticks at device measured frame rate
+    uint8_t* frame; // latest frame, sent on the next tick
+    bool pending;   // frame is not sent yet
+    mgos_twinkly_rt_source_t source;
+    void* source_arg;
+    uint8_t* canvas;                     // canonical RGB for RGB source, NULL if source renders wire format
+    struct mgos_twinkly_rt_store* store; // frames from another core / thread, NULL if not attached
+    float fps;
+    struct rt_pacer pacer;
+    struct mgos_twinkly_rt_group* group; // ticks come from the group, own pacer is idle
+    // Change suppression
+    uint32_t sent_hash;   // hash of the last sent frame
+    int64_t last_sent_us; // mgos_uptime_micros() based
+    struct mgos_twinkly_rt_stats stats;
+};
+
+static void rt_ev_handler(struct mg_connection* c, int ev, void* p, void* user_data) {
+    struct twinkly_rt* rt = user_data;
+    switch (ev) {
+        case MG_EV_RECV: {
+            // Device does not answer rt frames, dropping anything received
+            mbuf_remove(&c->recv_mbuf, c->recv_mbuf.len);
+            break;
+        }
+        case MG_EV_CLOSE: {
+            if (rt) {
+                LOG(LL_INFO, ("%.*s - rt stream closed", rt->ip.len, rt->ip.p));
+                rt->c = NULL;
+                rt->active = false;
+            }
+            break;
+        }
+    }
+    (void) p;
+}
+
+static void rt_pacer_stop(struct rt_pacer* p);
+static void rt_group_detach(struct twinkly_rt* rt);
+
+static void rt_store_free(struct mgos_twinkly_rt_store* s) {
+    if (!s)
+        return;
+    free(s->buf[0]);
+    free(s);
+}
+
+static struct mgos_twinkly_rt_store* rt_store_new(size_t leds) {
+    struct mgos_twinkly_rt_store* s = calloc(1, sizeof(struct mgos_twinkly_rt_store));
+    if (!s)
+        return NULL;
+    // One block for all three buffers
+    s->buf[0] = calloc(3, leds * 3);
+    if (!s->buf[0]) {
+        free(s);
+        return NULL;
+    }
+    s->buf[1] = s->buf[0] + leds * 3;
+    s->buf[2] = s->buf[1] + leds * 3;
+    s->leds = leds;
+    s->back = 0;
+    s->middle = 1;
+    s->front = 2;
+    return s;
+}
+
+// Consumer side: latest published frame, NULL if nothing new since the last call
+static const uint8_t* rt_store_take(struct mgos_twinkly_rt_store* s) {
+    if (!(__atomic_load_n(&s->middle, __ATOMIC_RELAXED) & RT_STORE_FRESH))
+        return NULL;
+    uint32_t m = __atomic_exchange_n(&s->middle, s->front, __ATOMIC_ACQ_REL);
+    s->front = m & ~RT_STORE_FRESH;
+    return s->buf[s->front];
+}
+
+static bool rt_set_token(struct twinkly_rt* rt, struct mg_str auth_token) {
+    char token[RT_TOKEN_LEN + 4];
+    int len = 0;
+    // Token comes from the device, longer input would not fit the decode buffer
+    if (auth_token.len <= 4 * ((RT_TOKEN_LEN + 2) / 3))
+        cs_base64_decode((const unsigned char*) auth_token.p, auth_token.len, token, &len);
+    if (len != RT_TOKEN_LEN) {
+        LOG(LL_ERROR, ("%.*s - invalid auth token", rt->ip.len, rt->ip.p));
+        return false;
+    }
+    memcpy(rt->token, token, RT_TOKEN_LEN);
+    return true;
+}
+
+void twinkly_rt_token_update(struct twinkly_device* dev, struct mg_str auth_token) {
+    if (!dev || !dev->rt)
+        return;
+    rt_set_token(dev->rt, auth_token);
+}
+
+void twinkly_rt_free(struct twinkly_rt* rt) {
+    if (!rt)
+        return;
+    rt_pacer_stop(&rt->pacer);
+    rt_group_detach(rt);
+    // Store is owned by the caller, a producer may still be writing into it
+    if (rt->store) {
+        rt->store->rt = NULL;
+        rt->store = NULL;
+    }
+    if (rt->c) {
+        rt->c->flags |= MG_F_CLOSE_IMMEDIATELY;
+        rt->c->user_data = NULL;
+    }
+    if (rt->starting) {
+        rt->stopped = true;
+        return;
+    }
+    mg_strfree(&rt->ip);
+    free(rt->pkt);
+    free(rt->frame);
+    free(rt->lut);
+    free(rt->rgb);
+    free(rt->canvas);
+    free(rt);
+}
+
+static bool rt_send(struct twinkly_rt* rt, const uint8_t* frame, size_t len) {
+    if (!rt->active || !rt->c)
+        return false;
+    if (len > rt->leds * rt->bpl)
+        len = rt->leds * rt->bpl;
+    uint8_t* pkt = rt->pkt;
+    switch (rt->proto) {
+        case 1: {
+            pkt[0] = 0x01;
+            memcpy(pkt + 1, rt->token, RT_TOKEN_LEN);
+            pkt[9] = (uint8_t)(rt->leds > 255 ? 255 : rt->leds);
+            memcpy(pkt + RT_HEADER_V1_LEN, frame, len);
+            mg_send(rt->c, pkt, RT_HEADER_V1_LEN + len);
+            break;
+        }
+        case 2: {
+            pkt[0] = 0x02;
+            memcpy(pkt + 1, rt->token, RT_TOKEN_LEN);
+            pkt[9] = 0x00;
+            memcpy(pkt + RT_HEADER_V2_LEN, frame, len);
+            mg_send(rt->c, pkt, RT_HEADER_V2_LEN + len);
+            break;
+        }
+        default: {
+            // v3, frame is split into numbered fragments
+            pkt[0] = 0x03;
+            memcpy(pkt + 1, rt->token, RT_TOKEN_LEN);
+            pkt[9] = 0x00;
+            pkt[10] = 0x00;
+            uint8_t fragment = 0;
+            for (size_t off = 0; off < len; off += RT_FRAGMENT_LEN) {
+                size_t n = (len - off > RT_FRAGMENT_LEN) ? RT_FRAGMENT_LEN : len - off;
+                pkt[11] = fragment++;
+                memcpy(pkt + RT_HEADER_V3_LEN, frame + off, n);
+                mg_send(rt->c, pkt, RT_HEADER_V3_LEN + n);
+            }
+            break;
+        }
+    }
+    rt->stats.frames_sent++;
+    rt->last_sent_us = mgos_uptime_micros();
+    return true;
+}
+
+// FNV-1a, cheap enough to run over every frame
+static uint32_t rt_frame_hash(const uint8_t* frame, size_t len) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= frame[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static void rt_pacer_schedule(struct rt_pacer* p) {
+    int64_t delay = (p->next_us - mgos_uptime_micros()) / 1000;
+    p->timer = mgos_set_timer(delay > 0 ? (int) delay : 0, 0, p->cb, p->arg);
+}
+
+static void rt_pacer_start(struct rt_pacer* p, float fps, timer_callback cb, void* arg) {
+    p->fps = fps;
+    p->period_us = (int64_t)(1000000.0 / fps);
+    p->next_us = mgos_uptime_micros() + p->period_us;
+    p->cb = cb;
+    p->arg = arg;
+    rt_pacer_schedule(p);
+}
+
+static void rt_pacer_stop(struct rt_pacer* p) {
+    if (p->timer != MGOS_INVALID_TIMER_ID) {
+        mgos_clear_timer(p->timer);
+        p->timer = MGOS_INVALID_TIMER_ID;
+    }
+}
+
+// Called first thing on the tick, returns current time
+static int64_t rt_pacer_tick(struct rt_pacer* p) {
+    p->timer = MGOS_INVALID_TIMER_ID;
+    int64_t now = mgos_uptime_micros();
+    int64_t late = now - p->next_us;
+    uint32_t jitter = (uint32_t)(late > 0 ? late : -late);
+    p->jitter_avg_us += ((int32_t) jitter - (int32_t) p->jitter_avg_us) / RT_JITTER_EWMA;
+    if (jitter > p->jitter_max_us)
+        p->jitter_max_us = jitter;
+    if (late > p->period_us / 2)
+        p->ticks_late++;
+    // Drift correction: deadlines stay on the period grid, missed ones are skipped, not caught up
+    p->next_us += p->period_us;
+    if (p->next_us <= now) {
+        int64_t missed = (now - p->next_us) / p->period_us + 1;
+        p->ticks_skipped += (uint32_t) missed;
+        p->next_us += missed * p->period_us;
+    }
+    return now;
+}
+
+// Sends pending frame, returns true if anything was sent
+static bool rt_output(struct twinkly_rt* rt, int64_t now) {
+    size_t len = rt->leds * rt->bpl;
+    bool sent = false;
+    // Unchanged frames only go out as keepalives, holding the device in rt mode
+    bool keepalive = rt->stats.frames_sent && (now - rt->last_sent_us >= RT_KEEPALIVE_US);
+    if (rt->pending) {
+        rt->pending = false;
+        uint32_t hash = rt_frame_hash(rt->frame, len);
+        if (!rt->stats.frames_sent || hash != rt->sent_hash) {
+            if ((sent = rt_send(rt, rt->frame, len)))
+                rt->sent_hash = hash;
+        } else if (keepalive) {
+            if ((sent = rt_send(rt, rt->frame, len)))
+                rt->stats.frames_keepalive++;
+        } else {
+            rt->stats.frames_skipped++;
+        }
+    } else if (keepalive) {
+        if ((sent = rt_send(rt, rt->frame, len)))
+            rt->stats.frames_keepalive++;
+    }
+    return sent;
+}
+
+// Canonical RGB to the frame buffer, color corrected
+static void rt_convert(struct twinkly_rt* rt, const uint8_t* rgb, size_t leds) {
+    if (rt->lut) {
+        mgos_twinkly_lut_apply(rt->lut, rgb, rt->rgb, leds);
+        rgb = rt->rgb;
+    }
+    rt->convert(rgb, rt->frame, leds);
+}
+
+static void rt_tick_cb(void* arg) {
+    struct twinkly_rt* rt = arg;
+    int64_t now = rt_pacer_tick(&rt->pacer);
+    const uint8_t* stored = NULL;
+    if (rt->store && (stored = rt_store_take(rt->store))) {
+        rt_convert(rt, stored, rt->leds);
+        rt->pending = true;
+    } else if (rt->source && rt->canvas) {
+        if (rt->source(rt->canvas, rt->leds * 3, rt->source_arg)) {
+            rt_convert(rt, rt->canvas, rt->leds);
+            rt->pending = true;
+        }
+    } else if (rt->source) {
+        if (rt->source(rt->frame, rt->leds * rt->bpl, rt->source_arg))
+            rt->pending = true;
+    }
+    rt_output(rt, now);
+    if (rt->active)
+        rt_pacer_schedule(&rt->pacer);
+}
+
+bool mgos_twinkly_rt_send(int idx, const uint8_t* frame, size_t len) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !dev->rt)
+        return false;
+    // Pacer dedup compares against what the device shows now, not the last paced frame
+    if (!rt_send(dev->rt, frame, len))
+        return false;
+    dev->rt->sent_hash = rt_frame_hash(frame, len);
+    return true;
+}
+
+bool mgos_twinkly_rt_submit(int idx, const uint8_t* frame, size_t len) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !dev->rt || !dev->rt->active)
+        return false;
+    struct twinkly_rt* rt = dev->rt;
+    size_t size = rt->leds * rt->bpl;
+    if (len > size)
+        len = size;
+    // Producer is ahead of the device, previous frame is dropped
+    if (rt->pending)
+        rt->stats.frames_dropped++;
+    memcpy(rt->frame, frame, len);
+    rt->pending = true;
+    return true;
+}
+
+bool mgos_twinkly_rt_submit_rgb(int idx, const uint8_t* rgb, size_t leds) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !dev->rt || !dev->rt->active || !dev->rt->convert)
+        return false;
+    struct twinkly_rt* rt = dev->rt;
+    if (leds > rt->leds)
+        leds = rt->leds;
+    if (rt->pending)
+        rt->stats.frames_dropped++;
+    rt_convert(rt, rgb, leds);
+    rt->pending = true;
+    return true;
+}
+
+bool mgos_twinkly_rt_set_correction(int idx, float gamma, int brightness, int kelvin) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !dev->rt)
+        return false;
+    struct twinkly_rt* rt = dev->rt;
+    if (!rt->lut) {
+        rt->lut = calloc(1, sizeof(struct mgos_twinkly_lut));
+        rt->rgb = malloc(rt->leds * 3);
+        if (!rt->lut || !rt->rgb) {
+            free(rt->lut);
+            free(rt->rgb);
+            rt->lut = NULL;
+            rt->rgb = NULL;
+            return false;
+        }
+    } else if (rt->lut->gamma == gamma && rt->lut->brightness == brightness && rt->lut->kelvin == kelvin) {
+        return true;
+    }
+    mgos_twinkly_lut_build(rt->lut, gamma, brightness, kelvin);
+    return true;
+}
+
+bool mgos_twinkly_rt_set_source(int idx, mgos_twinkly_rt_source_t source, void* arg) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !dev->rt)
+        return false;
+    free(dev->rt->canvas);
+    dev->rt->canvas = NULL;
+    dev->rt->source = source;
+    dev->rt->source_arg = arg;
+    return true;
+}
+
+bool mgos_twinkly_rt_set_source_rgb(int idx, mgos_twinkly_rt_source_t source, void* arg) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !dev->rt || !dev->rt->active || !dev->rt->convert)
+        return false;
+    struct twinkly_rt* rt = dev->rt;
+    if (!source)
+        return mgos_twinkly_rt_set_source(idx, NULL, NULL);
+    if (!rt->canvas) {
+        rt->canvas = calloc(rt->leds, 3);
+        if (!rt->canvas)
+            return false;
+    }
+    rt->source = source;
+    rt->source_arg = arg;
+    return true;
+}
+
+struct mgos_twinkly_rt_store* mgos_twinkly_rt_store_attach(int idx) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !dev->rt || !dev->rt->active || !dev->rt->convert)
+        return NULL;
+    struct twinkly_rt* rt = dev->rt;
+    if (!rt->store) {
+        rt->store = rt_store_new(rt->leds);
+        if (rt->store)
+            rt->store->rt = rt;
+    }
+    return rt->store;
+}
+
+void mgos_twinkly_rt_store_detach(struct mgos_twinkly_rt_store* s) {
+    if (!s)
+        return;
+    if (s->rt)
+        s->rt->store = NULL;
+    rt_store_free(s);
+}
+
+uint8_t* mgos_twinkly_rt_store_back(struct mgos_twinkly_rt_store* s, size_t* leds) {
+    if (!s)
+        return NULL;
+    if (leds)
+        *leds = s->leds;
+    return s->buf[s->back];
+}
+
+void mgos_twinkly_rt_store_publish(struct mgos_twinkly_rt_store* s) {
+    if (!s)
+        return;
+    // Release makes the back buffer contents visible before its index
+    uint32_t m = __atomic_exchange_n(&s->middle, s->back | RT_STORE_FRESH, __ATOMIC_ACQ_REL);
+    s->back = m & ~RT_STORE_FRESH;
+    __atomic_store_n(&s->published, s->published + 1, __ATOMIC_RELAXED);
+    if (m & RT_STORE_FRESH)
+        __atomic_store_n(&s->dropped, s->dropped + 1, __ATOMIC_RELAXED);
+}
+
+bool mgos_twinkly_rt_get_stats(int idx, struct mgos_twinkly_rt_stats* stats) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !dev->rt || !stats)
+        return false;
+    struct twinkly_rt* rt = dev->rt;
+    struct rt_pacer* p = rt->group ? &rt->group->pacer : &rt->pacer;
+    *stats = rt->stats;
+    stats->ticks_late = p->ticks_late;
+    stats->ticks_skipped = p->ticks_skipped;
+    stats->jitter_avg_us = p->jitter_avg_us;
+    stats->jitter_max_us = p->jitter_max_us;
+    stats->fps = rt->group ? p->fps : rt->fps;
+    if (rt->store)
+        stats->frames_dropped += __atomic_load_n(&rt->store->dropped, __ATOMIC_RELAXED);
+    return true;
+}
+
+// Group output
+static void rt_group_tick_cb(void* arg) {
+    struct mgos_twinkly_rt_group* g = arg;
+    rt_pacer_tick(&g->pacer);
+    // Without source canvas is written by the application directly
+    bool changed = g->source ? g->source(g->canvas, g->leds * 3, g->source_arg) : true;
+    // Building all frames first, so datagrams go out back-to-back
+    size_t off = 0;
+    for (int i = 0; i < g->members_cnt; i++) {
+        struct twinkly_rt* rt = g->members[i];
+        if (changed && rt->active && rt->convert) {
+            rt_convert(rt, g->canvas + off * 3, rt->leds);
+            rt->pending = true;
+        }
+        off += rt->leds;
+    }
+    int64_t first = 0, last = 0;
+    for (int i = 0; i < g->members_cnt; i++) {
+        struct twinkly_rt* rt = g->members[i];
+        int64_t t = mgos_uptime_micros();
+        if (!rt_output(rt, t))
+            continue;
+        if (!first)
+            first = t;
+        last = t;
+        rt->stats.skew_us = (uint32_t)(t - first);
+    }
+    g->stats.ticks++;
+    if (first) {
+        uint32_t skew = (uint32_t)(last - first);
+        g->stats.skew_avg_us += ((int32_t) skew - (int32_t) g->stats.skew_avg_us) / RT_JITTER_EWMA;
+        if (skew > g->stats.skew_max_us)
+            g->stats.skew_max_us = skew;
+    }
+    rt_pacer_schedule(&g->pacer);
+}
+
+static void rt_group_detach(struct twinkly_rt* rt) {
+    struct mgos_twinkly_rt_group* g = rt->group;
+    if (!g)
+        return;
+    size_t off = 0; // member canvas offset, leds
+    for (int i = 0; i < g->members_cnt; i++) {
+        if (g->members[i] == rt) {
+            // Canvas slices follow the member order, later members move down with their pixels
+            memmove(g->canvas + off * 3, g->canvas + (off + rt->leds) * 3, (g->leds - off - rt->leds) * 3);
+            memmove(&g->members[i], &g->members[i + 1], (g->members_cnt - i - 1) * sizeof(struct twinkly_rt*));
+            g->members_cnt--;
+            g->leds -= rt->leds;
+            break;
+        }
+        off += g->members[i]->leds;
+    }
+    rt->group = NULL;
+}
+
+struct mgos_twinkly_rt_group* mgos_twinkly_rt_group_new(float fps) {
+    struct mgos_twinkly_rt_group* g = calloc(1, sizeof(struct mgos_twinkly_rt_group));
+    if (!g)
+        return NULL;
+    g->pacer.fps = fps;
+    return g;
+}
+
+bool mgos_twinkly_rt_group_add(struct mgos_twinkly_rt_group* g, int idx) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!g || !dev || !dev->rt || dev->rt->group)
+        return false;
+    struct twinkly_rt* rt = dev->rt;
+    struct twinkly_rt** members = realloc(g->members, (g->members_cnt + 1) * sizeof(struct twinkly_rt*));
+    if (!members)
+        return false;
+    g->members = members;
+    uint8_t* canvas = realloc(g->canvas, (g->leds + rt->leds) * 3);
+    if (!canvas)
+        return false;
+    memset(canvas + g->leds * 3, 0, rt->leds * 3);
+    g->canvas = canvas;
+    g->members[g->members_cnt++] = rt;
+    g->leds += rt->leds;
+    // Group tick drives the member from now
+    rt_pacer_stop(&rt->pacer);
+    rt->group = g;
+    return true;
+}
+
+uint8_t* mgos_twinkly_rt_group_canvas(struct mgos_twinkly_rt_group* g, size_t* leds) {
+    if (!g)
+        return NULL;
+    if (leds)
+        *leds = g->leds;
+    return g->canvas;
+}
+
+bool mgos_twinkly_rt_group_set_source(struct mgos_twinkly_rt_group* g, mgos_twinkly_rt_source_t source, void* arg) {
+    if (!g)
+        return false;
+    g->source = source;
+    g->source_arg = arg;
+    return true;
+}
+
+bool mgos_twinkly_rt_group_start(struct mgos_twinkly_rt_group* g) {
+    if (!g || !g->members_cnt)
+        return false;
+    float fps = g->pacer.fps;
+    // Slowest member sets the pace unless given
+    if (fps <= 0) {
+        for (int i = 0; i < g->members_cnt; i++)
+            if (fps <= 0 || g->members[i]->fps < fps)
+                fps = g->members[i]->fps;
+    }
+    rt_pacer_stop(&g->pacer);
+    rt_pacer_start(&g->pacer, fps, rt_group_tick_cb, g);
+    return true;
+}
+
+void mgos_twinkly_rt_group_free(struct mgos_twinkly_rt_group* g) {
+    if (!g)
+        return;
+    rt_pacer_stop(&g->pacer);
+    while (g->members_cnt) {
+        struct twinkly_rt* rt = g->members[0];
+        rt_group_detach(rt);
+        // Back to own pacing
+        if (rt->active)
+            rt_pacer_start(&rt->pacer, rt->fps, rt_tick_cb, rt);
+    }
+    free(g->members);
+    free(g->canvas);
+    free(g);
+}
+
+bool mgos_twinkly_rt_group_get_stats(struct mgos_twinkly_rt_group* g, struct mgos_twinkly_rt_group_stats* stats) {
+    if (!g || !stats)
+        return false;
+    *stats = g->stats;
+    stats->ticks_late = g->pacer.ticks_late;
+    stats->ticks_skipped = g->pacer.ticks_skipped;
+    stats->jitter_avg_us = g->pacer.jitter_avg_us;
+    stats->jitter_max_us = g->pacer.jitter_max_us;
+    stats->fps = g->pacer.fps;
+    return true;
+}
+
+static void rt_start_done(struct twinkly_rt* rt, int res) {
+    tw_cb_t cb = rt->cb;
+    void* arg = rt->arg;
+    rt->cb = NULL;
+    rt->arg = NULL;
+    if (cb)
+        cb((void*) res, arg);
+}
+
+static void rt_mode_cb(void* data, void* arg) {
+    LOG(LL_DEBUG, ("%s %p %p", __func__, data, arg));
+    struct http_message* hm = data;
+    struct async_ctx* device = arg;
+    struct twinkly_rt* rt = device->arg;
+    int res = MGOS_TWINKLY_ERROR_OK;
+    int code = 0;
+    rt->starting = false;
+    if (rt->stopped) {
+        // Stopped or freed while led/mode was in flight, the caller still waits for the result
+        rt_start_done(rt, MGOS_TWINKLY_ERROR_RESPONSE);
+        twinkly_rt_free(rt);
+        goto exit;
+    }
+    if (!hm) {
+        res = MGOS_TWINKLY_ERROR_TIMEOUT;
+    } else if (
+            hm->resp_code != 200 || json_scanf(hm->body.p, hm->body.len, "{code: %d}", &code) != 1 || code != 1000) {
+        LOG(LL_ERROR, ("%.*s - rt mode error %ld, code %ld", rt->ip.len, rt->ip.p, (long) hm->resp_code, (long) code));
+        res = MGOS_TWINKLY_ERROR_RESPONSE;
+    } else if (!rt_set_token(rt, device->auth_token)) {
+        res = MGOS_TWINKLY_ERROR_RESPONSE;
+    } else {
+        char* addr = NULL;
+        mg_asprintf(&addr, 0, "udp://%.*s:%d", rt->ip.len, rt->ip.p, MGOS_TWINKLY_RT_PORT);
+        rt->c = mg_connect(mgos_get_mgr(), addr, rt_ev_handler, rt);
+        free(addr);
+        if (!rt->c)
+            res = MGOS_TWINKLY_ERROR_MEM;
+    }
+    if (res == MGOS_TWINKLY_ERROR_OK) {
+        rt->active = true;
+        LOG(LL_INFO,
+            ("%.*s - rt v%d stream, %d leds x %d at %.1f fps",
+             rt->ip.len,
+             rt->ip.p,
+             rt->proto,
+             rt->leds,
+             rt->bpl,
+             rt->fps));
+        if (!rt->group)
+            rt_pacer_start(&rt->pacer, rt->fps, rt_tick_cb, rt);
+        rt_start_done(rt, res);
+    } else {
+        // Device record could be removed or moved meanwhile
+        struct twinkly_device* dev = twinkly_registry_get(twinkly_registry_find(rt->ip));
+        if (dev && dev->rt == rt)
+            dev->rt = NULL;
+        rt_start_done(rt, res);
+        twinkly_rt_free(rt);
+    }
+exit:
+    twinkly_device_free(device);
+}
+
+bool mgos_twinkly_rt_start(int idx, tw_cb_t cb, void* arg) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev) {
+        LOG(LL_ERROR, ("Failed to get device %ld", (long) idx));
+        return false;
+    }
+    if (DEVICE_UNBOUND(dev)) {
+        LOG(LL_ERROR, ("%.*s - device has no address, waiting for re-resolution", dev->mac.len, dev->mac.p));
+        if (cb)
+            cb((void*) MGOS_TWINKLY_ERROR_UNBOUND, arg);
+        return true;
+    }
+    if (dev->rt) {
+        if (cb)
+            cb((void*) MGOS_TWINKLY_ERROR_OK, arg);
+        return true;
+    }
+    int leds = 0, bpl = 3;
+    float frame_rate = 0, measured_frame_rate = 0;
+    char* led_profile = NULL;
+    json_scanf(
+            dev->json.p,
+            dev->json.len,
+            "{number_of_led: %d, bytes_per_led: %d, frame_rate: %f, measured_frame_rate: %f, led_profile: %Q}",
+            &leds,
+            &bpl,
+            &frame_rate,
+            &measured_frame_rate,
+            &led_profile);
+    int profile_bpl = 0;
+    mgos_twinkly_pixel_fn_t convert = mgos_twinkly_pixel_get_fn(led_profile ? led_profile : "RGB", &profile_bpl);
+    if (convert && profile_bpl != bpl) {
+        LOG(LL_WARN, ("%.*s - led profile %s does not match %d bytes per led", dev->ip.len, dev->ip.p, led_profile, bpl));
+        convert = NULL;
+    }
+    free(led_profile);
+    if (leds <= 0 || bpl <= 0 || bpl > DEVICE_FAMILY(dev)->max_bpl) {
+        LOG(LL_ERROR, ("%.*s - unsupported led config %d x %d", dev->ip.len, dev->ip.p, leds, bpl));
+        return false;
+    }
+    struct twinkly_rt* rt = calloc(1, sizeof(struct twinkly_rt));
+    if (!rt)
+        return false;
+    rt->proto = DEVICE_FAMILY(dev)->rt_proto;
+    rt->leds = leds;
+    rt->bpl = bpl;
+    rt->convert = convert;
+    // Device can not show frames faster than it measured itself
+    rt->fps = measured_frame_rate > 0 ? measured_frame_rate : frame_rate > 0 ? frame_rate : RT_FPS_DEFAULT;
+    rt->pkt = malloc(RT_HEADER_V3_LEN + (leds * bpl > RT_FRAGMENT_LEN ? leds * bpl : RT_FRAGMENT_LEN));
+    rt->frame = calloc(1, leds * bpl);
+    struct async_ctx* device = twinkly_device_new(dev->ip);
+    if (!rt->pkt || !rt->frame || !device) {
+        free(rt->pkt);
+        free(rt->frame);
+        free(rt);
+        if (device)
+            twinkly_device_free(device);
+        return false;
+    }
+    rt->ip = mg_strdup(dev->ip);
+    rt->cb = cb;
+    rt->arg = arg;
+    rt->starting = true;
+    dev->rt = rt;
+    twinkly_device_request(device, METHOD_LED_MODE, "{\"mode\":\"rt\"}", rt_mode_cb, rt);
+    return true;
+}
+
+void mgos_twinkly_rt_stop(int idx) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    if (!dev || !dev->rt)
+        return;
+    struct twinkly_rt* rt = dev->rt;
+    dev->rt = NULL;
+    twinkly_rt_free(rt);
+}
+
+bool mgos_twinkly_rt_active(int idx) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    return dev && dev->rt && dev->rt->active;
+}
+
+int mgos_twinkly_rt_frame_size(int idx) {
+    struct twinkly_device* dev = twinkly_registry_get(idx);
+    return (dev && dev->rt) ? dev->rt->leds * dev->rt->bpl : 0;
+}
+